@@ -0,0 +1,207 @@
+/*
+ day_of_week benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+using rata_die_t = int32_t;
+using weekday_t  = uint8_t;
+
+// Rata dies are counted from 1970-Jan-01 (a Thursday) and days of the week are encoded as in
+// std::chrono::weekday::c_encoding (0 = Sunday, ..., 6 = Saturday).
+
+namespace naive {
+
+weekday_t day_of_week(rata_die_t n) {
+  auto const r = (n + 4) % 7;
+  return weekday_t(r < 0 ? r + 7 : r);
+}
+}
+
+namespace std_chrono {
+
+weekday_t day_of_week(rata_die_t n) {
+  using namespace std::chrono;
+  return weekday_t(weekday(sys_days(days(n))).c_encoding());
+}
+}
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+weekday_t day_of_week(rata_die_t n) {
+
+  // 536895458 is the offset of rata dies from 1970-Jan-01 to 0000-Mar-01 (a Wednesday).
+  auto constexpr r_offset = uint32_t(536895458 + 3);
+
+  auto const n0 = uint32_t(n) + r_offset;
+  auto const u  = uint32_t(613566757 * n0);
+  return weekday_t(uint64_t(7) * u >> 32);
+}
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+namespace neri_schneider::avx2 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx2")]]
+__m256i mulhi(__m256i a, uint32_t c) {
+  auto const b    = _mm256_set1_epi32(int(c));
+  auto const even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  auto const odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  return _mm256_blend_epi32(even, odd, 0b10101010);
+}
+
+// Processes 32 rata dies at a time. Hence, size must be a multiple of 32.
+[[gnu::target("avx2")]]
+void day_of_week(rata_die_t const* r, size_t size, weekday_t* w) {
+
+  auto const cr = _mm256_set1_epi32(536895458 + 3);
+  auto const c  = _mm256_set1_epi32(613566757);
+
+  auto const get = [&](size_t i) __attribute__((target("avx2"))) {
+    auto const n = _mm256_add_epi32(_mm256_loadu_si256((__m256i const*)(r + i)), cr);
+    return mulhi(_mm256_mullo_epi32(n, c), 7);
+  };
+
+  for (size_t i = 0; i < size; i += 32) {
+    // Narrows 4 x 8 lanes of 32 bits into 32 lanes of 8 bits. Packs work within 128-bit halves,
+    // hence, the final permutation.
+    auto const a = _mm256_packs_epi32(get(i     ), get(i +  8));
+    auto const b = _mm256_packs_epi32(get(i + 16), get(i + 24));
+    auto const p = _mm256_packus_epi16(a, b);
+    auto const q = _mm256_permutevar8x32_epi32(p, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    _mm256_storeu_si256((__m256i*)(w + i), q);
+  }
+}
+}
+
+#endif
+
+#if defined(__x86_64__)
+
+namespace neri_schneider::avx512 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx512f,avx512bw")]]
+__m512i mulhi(__m512i a, uint32_t c) {
+  auto const b    = _mm512_set1_epi32(int(c));
+  auto const even = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+  auto const odd  = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), b);
+  return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+
+// Processes 16 rata dies at a time. Hence, size must be a multiple of 16.
+[[gnu::target("avx512f,avx512bw")]]
+void day_of_week(rata_die_t const* r, size_t size, weekday_t* w) {
+
+  auto const cr = _mm512_set1_epi32(536895458 + 3);
+  auto const c  = _mm512_set1_epi32(613566757);
+
+  for (size_t i = 0; i < size; i += 16) {
+    auto const n = _mm512_add_epi32(_mm512_loadu_si512(r + i), cr);
+    _mm_storeu_si128((__m128i*)(w + i), _mm512_cvtepi32_epi8(mulhi(_mm512_mullo_epi32(n, c), 7)));
+  }
+}
+}
+
+#endif
+
+auto const rata_dies = [](){
+  std::uniform_int_distribution<rata_die_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<rata_die_t, 16384> rata_dies;
+  for (auto& n : rata_dies)
+    n = uniform_dist(rng);
+  return rata_dies;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const n : rata_dies)
+        benchmark::DoNotOptimize(n);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (auto const n : rata_dies) { \
+        auto const w = namespace::day_of_week(n); \
+        benchmark::DoNotOptimize(w); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+#define DO_BATCH_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<weekday_t, 16384> weekdays; \
+    for (auto _ : state) { \
+      namespace::day_of_week(rata_dies.data(), rata_dies.size(), weekdays.data()); \
+      benchmark::DoNotOptimize(weekdays); \
+    } \
+  } \
+  BENCHMARK(label)
+
+// As DO_BATCH_BENCHMARK for kernels compiled for instructions that the CPU might lack.
+#define DO_SIMD_BENCHMARK(label, namespace, isa) \
+  void label(benchmark::State& state) { \
+    if (!supports_##isa()) { \
+      state.SkipWithError("Unsupported instructions."); \
+      return; \
+    } \
+    std::array<weekday_t, 16384> weekdays; \
+    for (auto _ : state) { \
+      namespace::day_of_week(rata_dies.data(), rata_dies.size(), weekdays.data()); \
+      benchmark::DoNotOptimize(weekdays); \
+    } \
+  } \
+  BENCHMARK(label)
+
+#if defined(__x86_64__)
+bool supports_avx2() {
+  return __builtin_cpu_supports("avx2");
+}
+
+bool supports_avx512() {
+  return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+}
+#endif
+
+DO_BENCHMARK(Naive, naive);
+DO_BENCHMARK(StdChrono, std_chrono);
+DO_BENCHMARK(NeriSchneider, neri_schneider);
+
+#if defined(__x86_64__)
+DO_SIMD_BENCHMARK(NeriSchneider_AVX2, neri_schneider::avx2, avx2);
+DO_SIMD_BENCHMARK(NeriSchneider_AVX512, neri_schneider::avx512, avx512);
+#endif
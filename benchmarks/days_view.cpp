@@ -0,0 +1,145 @@
+/*
+ Day-stepping date view benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+
+ Generates all dates from 1970-Jan-01 to 2014-Nov-09 (16384 days) in order.
+*/
+
+#include <cstdint>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+using rata_die_t = int32_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+rata_die_t constexpr first = 0;
+rata_die_t constexpr last  = 16384;
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+date_t to_date(rata_die_t r) {
+
+  auto constexpr z2    = uint32_t(-1468000);
+  auto constexpr r2_e3 = uint32_t(536895458);
+
+  auto const r0 = r + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const y0 = 100 * q1 + q2;
+  auto const m0 = q3;
+  auto const d0 = r3;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = y0 + j;
+  auto const m1 = j ? m0 - 12 : m0;
+  auto const d1 = d0 + 1;
+
+  return {year_t(y1 + z2), month_t(m1), day_t(d1)};
+}
+
+bool is_leap_year(int32_t y) {
+  return (y & ((y % 100) == 0 ? 15 : 3)) == 0;
+}
+
+month_t last_day_of_month(int32_t y, month_t m) {
+  return m != 2 ? ((m ^ (m >> 3))) | 30 : is_leap_year(y) ? 29 : 28;
+}
+
+// Steps the day and carries into month and year (as days_view_t::iterator::operator ++).
+void next(date_t& u) {
+  if (u.day < 28 || u.day < last_day_of_month(u.year % 400, u.month))
+    ++u.day;
+  else if (u.month < 12) {
+    ++u.month;
+    u.day = 1;
+  }
+  else {
+    ++u.year;
+    u.month = 1;
+    u.day   = 1;
+  }
+}
+}
+
+namespace neri_schneider::view {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+template <typename F>
+void for_each(F f) {
+  auto u = neri_schneider::to_date(first);
+  for (auto n = first; n != last; ++n) {
+    f(u);
+    neri_schneider::next(u);
+  }
+}
+}
+
+namespace neri_schneider::loop {
+
+template <typename F>
+void for_each(F f) {
+  for (auto n = first; n != last; ++n)
+    f(neri_schneider::to_date(n));
+}
+}
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto n = first; n != last; ++n)
+        benchmark::DoNotOptimize(n);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      namespace::for_each([](date_t const& u) { \
+        benchmark::DoNotOptimize(u); \
+      }); \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(ToDateLoop, neri_schneider::loop);
+DO_BENCHMARK(DaysView, neri_schneider::view);
@@ -0,0 +1,170 @@
+/*
+ from_chars (ISO 8601 date parsing) benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+using rata_die_t = int32_t;
+
+// Dates are parsed from "YYYY-MM-DD" and converted to rata dies (counted from 1970-Jan-01).
+// Invalid dates are mapped to invalid.
+rata_die_t constexpr invalid = INT32_MIN;
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+auto constexpr z2    = uint32_t(-1468000);
+auto constexpr r2_e3 = uint32_t(536895458);
+
+bool is_leap_year(uint32_t y) {
+  return (y & (y % 100 == 0 ? 15 : 3)) == 0;
+}
+
+uint32_t last_day_of_month(uint32_t y, uint32_t m) {
+  return m != 2 ? ((m ^ (m >> 3))) | 30 : is_leap_year(y) ? 29 : 28;
+}
+
+rata_die_t to_rata_die(uint32_t y, uint32_t m, uint32_t d) {
+
+  auto const y1 = y - z2;
+  auto const m1 = m;
+  auto const d1 = d;
+
+  auto const j  = m1 < 3;
+  auto const y0 = y1 - j;
+  auto const m0 = j ? m1 + 12 : m1;
+  auto const d0 = d1 - 1;
+
+  auto const q1 = y0 / 100;
+  auto const yc = 1461 * y0 / 4 - q1 + q1 / 4;
+  auto const mc = (979 * m0 - 2919) / 32;
+  auto const dc = d0;
+
+  return yc + mc + dc - r2_e3;
+}
+
+rata_die_t from_chars(char const* first) {
+
+  uint64_t constexpr digits = 0x00ffff00ffffffff;
+  uint64_t constexpr zeros  = 0x3030303030303030 & digits;
+  uint64_t constexpr dashes = 0x2d00002d00000000;
+
+  uint64_t w = 0;
+  for (unsigned i = 0; i < 8; ++i)
+    w |= uint64_t(uint8_t(first[i])) << 8 * i;
+
+  auto const e = uint32_t(uint8_t(first[8])) | uint32_t(uint8_t(first[9])) << 8;
+
+  auto const ok_w = ((w & 0xf0f0f0f0f0f0f0f0 & digits) == zeros) &
+    (((w + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0 & digits) == zeros) & ((w & ~digits) == dashes);
+  auto const ok_e = ((e & 0xf0f0) == 0x3030) & (((e + 0x0606) & 0xf0f0) == 0x3030);
+
+  auto const v  = (w & digits) - zeros;
+  auto const p  = 10 * v + (v >> 8);
+  auto const y  = 100 * uint32_t(p & 0xff) + uint32_t(p >> 16 & 0xff);
+  auto const m  = uint32_t(p >> 40 & 0xff);
+  auto const f  = e - 0x3030;
+  auto const d  = 10 * (f & 0xff) + (f >> 8 & 0xff);
+
+  auto const ok = ok_w & ok_e & (m - 1 < 12) & (d - 1 < last_day_of_month(y, m));
+
+  return ok ? to_rata_die(y, m, d) : invalid;
+}
+}
+
+namespace std_from_chars {
+
+rata_die_t from_chars(char const* first) {
+  int y;
+  unsigned m, d;
+  auto const last = first + 10;
+  auto r = std::from_chars(first, last, y);
+  if (r.ec != std::errc() || r.ptr != first + 4 || *r.ptr != '-')
+    return invalid;
+  r = std::from_chars(r.ptr + 1, last, m);
+  if (r.ec != std::errc() || r.ptr != first + 7 || *r.ptr != '-')
+    return invalid;
+  r = std::from_chars(r.ptr + 1, last, d);
+  if (r.ec != std::errc() || r.ptr != last)
+    return invalid;
+  if (m - 1 >= 12 || d - 1 >= neri_schneider::last_day_of_month(y, m))
+    return invalid;
+  return neri_schneider::to_rata_die(y, m, d);
+}
+}
+
+namespace c_sscanf {
+
+rata_die_t from_chars(char const* first) {
+  int y;
+  unsigned m, d;
+  int n = 0;
+  if (std::sscanf(first, "%4d-%2u-%2u%n", &y, &m, &d, &n) != 3 || n != 10)
+    return invalid;
+  if (m - 1 >= 12 || d - 1 >= neri_schneider::last_day_of_month(y, m))
+    return invalid;
+  return neri_schneider::to_rata_die(y, m, d);
+}
+}
+
+// Fixed-width (11 characters) records, each holding "YYYY-MM-DD" and a null terminator.
+auto const chars = [](){
+  std::uniform_int_distribution<uint32_t> uniform_dist(0, 28 * 12 * 400 - 1);
+  std::mt19937 rng;
+  std::array<char, 11 * 16384> chars;
+  for (size_t i = 0; i < chars.size(); i += 11) {
+    auto const n = uniform_dist(rng);
+    std::snprintf(&chars[i], 11, "%04u-%02u-%02u", unsigned(1800 + n / 28 / 12) % 10000,
+      unsigned(n / 28 % 12 + 1) % 100, unsigned(n % 28 + 1) % 100);
+  }
+  return chars;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (size_t i = 0; i < chars.size(); i += 11)
+        benchmark::DoNotOptimize(chars[i]);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (size_t i = 0; i < chars.size(); i += 11) { \
+        auto const n = namespace::from_chars(&chars[i]); \
+        benchmark::DoNotOptimize(n); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(Sscanf, c_sscanf);
+DO_BENCHMARK(StdFromChars, std_from_chars);
+DO_BENCHMARK(NeriSchneider, neri_schneider);
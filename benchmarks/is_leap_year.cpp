@@ -74,7 +74,86 @@ bool is_leap_year(year_t year) {
   // offset & 15 == 0 and hence, year & 15 == sum & 15.
   return (sum & (is_multiple_of_100 ? 15 : 3)) == 0;
 }
+
+// Sets bit i % 64 of bits[i / 64] if, and only if, years[i] is leap. Size must be a multiple of 64.
+void is_leap_year(year_t const* years, size_t size, uint64_t* bits) {
+  for (size_t i = 0; i < size; i += 64) {
+    uint64_t word = 0;
+    for (size_t j = 0; j < 64; ++j)
+      word |= uint64_t(is_leap_year(years[i + j])) << j;
+    bits[i / 64] = word;
+  }
+}
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+namespace drepper_neri_schneider::avx2 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+// Same as mcomp2 with signed comparison on flipped sign bits since AVX2 lacks unsigned ones.
+[[gnu::target("avx2")]]
+void is_leap_year(year_t const* years, size_t size, uint64_t* bits) {
+
+  auto const c0         = _mm256_setzero_si256();
+  auto const c3         = _mm256_set1_epi32(3);
+  auto const c12        = _mm256_set1_epi32(12);
+  auto const sign       = _mm256_set1_epi32(int(0x80000000));
+  auto const bound      = _mm256_set1_epi32(int(42949669 ^ 0x80000000));
+  auto const multiplier = _mm256_set1_epi32(42949673);
+  auto const offset     = _mm256_set1_epi32(536870800);
+
+  for (size_t i = 0; i < size; i += 64) {
+    uint64_t word = 0;
+    for (size_t j = 0; j < 64; j += 8) {
+      auto const y    = _mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i const*)(years + i + j)));
+      auto const sum  = _mm256_add_epi32(y, offset);
+      auto const prod = _mm256_xor_si256(_mm256_mullo_epi32(sum, multiplier), sign);
+      auto const mask = _mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi32(bound, prod), c12),
+        c3);
+      auto const leap = _mm256_cmpeq_epi32(_mm256_and_si256(sum, mask), c0);
+      word |= uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(leap))) << j;
+    }
+    bits[i / 64] = word;
+  }
 }
+}
+
+#endif
+
+#if defined(__x86_64__)
+
+namespace drepper_neri_schneider::avx512 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx512f,avx512bw")]]
+void is_leap_year(year_t const* years, size_t size, uint64_t* bits) {
+
+  auto const c3         = _mm512_set1_epi32(3);
+  auto const c15        = _mm512_set1_epi32(15);
+  auto const bound      = _mm512_set1_epi32(42949669);
+  auto const multiplier = _mm512_set1_epi32(42949673);
+  auto const offset     = _mm512_set1_epi32(536870800);
+
+  for (size_t i = 0; i < size; i += 64) {
+    uint64_t word = 0;
+    for (size_t j = 0; j < 64; j += 16) {
+      auto const y    = _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i const*)(years + i + j)));
+      auto const sum  = _mm512_add_epi32(y, offset);
+      auto const j100 = _mm512_cmplt_epu32_mask(_mm512_mullo_epi32(sum, multiplier), bound);
+      auto const mask = _mm512_mask_blend_epi32(j100, c3, c15);
+      word |= uint64_t(_mm512_testn_epi32_mask(sum, mask)) << j;
+    }
+    bits[i / 64] = word;
+  }
+}
+}
+
+#endif
 
 namespace ubiquitous {
 bool is_leap_year(year_t y) {
@@ -119,3 +198,45 @@ DO_BENCHMARK(NeriSchneider_mcomp, neri_schneider::mcomp);
 DO_BENCHMARK(Drepper, drepper);
 DO_BENCHMARK(DrepperNeriSchneider_mcomp1, drepper_neri_schneider::mcomp1);
 DO_BENCHMARK(DrepperNeriSchneider_mcomp2, drepper_neri_schneider::mcomp2);
+
+#define DO_BATCH_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<uint64_t, years.size() / 64> bits; \
+    for (auto _ : state) { \
+      namespace::is_leap_year(years.data(), years.size(), bits.data()); \
+      benchmark::DoNotOptimize(bits); \
+    } \
+  } \
+  BENCHMARK(label)
+
+// As DO_BATCH_BENCHMARK for kernels compiled for instructions that the CPU might lack.
+#define DO_SIMD_BENCHMARK(label, namespace, isa) \
+  void label(benchmark::State& state) { \
+    if (!supports_##isa()) { \
+      state.SkipWithError("Unsupported instructions."); \
+      return; \
+    } \
+    std::array<uint64_t, years.size() / 64> bits; \
+    for (auto _ : state) { \
+      namespace::is_leap_year(years.data(), years.size(), bits.data()); \
+      benchmark::DoNotOptimize(bits); \
+    } \
+  } \
+  BENCHMARK(label)
+
+#if defined(__x86_64__)
+bool supports_avx2() {
+  return __builtin_cpu_supports("avx2");
+}
+
+bool supports_avx512() {
+  return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+}
+#endif
+
+DO_BATCH_BENCHMARK(DrepperNeriSchneider_mcomp2_Bits, drepper_neri_schneider::mcomp2);
+
+#if defined(__x86_64__)
+DO_SIMD_BENCHMARK(DrepperNeriSchneider_AVX2, drepper_neri_schneider::avx2, avx2);
+DO_SIMD_BENCHMARK(DrepperNeriSchneider_AVX512, drepper_neri_schneider::avx512, avx512);
+#endif
@@ -48,8 +48,106 @@ day_t last_day_of_month(year_t year, month_t month) {
   return month != 2 ? (month ^ (month >> 3)) | 30 :
     is_leap_year(year) ? 29 : 28;
 }
+
+void last_day_of_month(year_t const* years, month_t const* months, size_t size, day_t* days) {
+  for (size_t i = 0; i < size; ++i)
+    days[i] = last_day_of_month(years[i], months[i]);
+}
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+namespace neri_schneider::avx2 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+// Lanes are set to -1 for leap years and to 0 otherwise.
+[[gnu::target("avx2")]]
+__m256i is_leap_year(__m256i y) {
+  auto const c0         = _mm256_setzero_si256();
+  auto const c3         = _mm256_set1_epi32(3);
+  auto const c12        = _mm256_set1_epi32(12);
+  auto const sign       = _mm256_set1_epi32(int(0x80000000));
+  auto const bound      = _mm256_set1_epi32(int(42949669 ^ 0x80000000));
+  auto const multiplier = _mm256_set1_epi32(42949673);
+  auto const offset     = _mm256_set1_epi32(536870800);
+  auto const sum        = _mm256_add_epi32(y, offset);
+  auto const prod       = _mm256_xor_si256(_mm256_mullo_epi32(sum, multiplier), sign);
+  auto const mask       = _mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi32(bound, prod), c12),
+    c3);
+  return _mm256_cmpeq_epi32(_mm256_and_si256(sum, mask), c0);
+}
+
+// Processes 32 elements at a time. Hence, size must be a multiple of 32.
+[[gnu::target("avx2")]]
+void last_day_of_month(year_t const* years, month_t const* months, size_t size, day_t* days) {
+
+  auto const c2      = _mm256_set1_epi32(2);
+  auto const c28     = _mm256_set1_epi32(28);
+  auto const c30     = _mm256_set1_epi32(30);
+  auto const permute = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+  auto const last_day_of_month = [&](size_t i) __attribute__((target("avx2"))) {
+    auto const y = _mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i const*)(years + i)));
+    auto const m = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(months + i)));
+    auto const o = _mm256_or_si256(_mm256_xor_si256(m, _mm256_srli_epi32(m, 3)), c30);
+    auto const f = _mm256_sub_epi32(c28, is_leap_year(y));
+    return _mm256_blendv_epi8(o, f, _mm256_cmpeq_epi32(m, c2));
+  };
+
+  for (size_t i = 0; i < size; i += 32) {
+    auto const d01 = _mm256_packs_epi32(last_day_of_month(i), last_day_of_month(i + 8));
+    auto const d23 = _mm256_packs_epi32(last_day_of_month(i + 16), last_day_of_month(i + 24));
+    auto const d   = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(d01, d23), permute);
+    _mm256_storeu_si256((__m256i*)(days + i), d);
+  }
+}
+}
+
+#endif
+
+#if defined(__x86_64__)
+
+namespace neri_schneider::avx512 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx512f,avx512bw")]]
+__mmask16 is_leap_year(__m512i y) {
+  auto const c3         = _mm512_set1_epi32(3);
+  auto const c15        = _mm512_set1_epi32(15);
+  auto const bound      = _mm512_set1_epi32(42949669);
+  auto const multiplier = _mm512_set1_epi32(42949673);
+  auto const offset     = _mm512_set1_epi32(536870800);
+  auto const sum        = _mm512_add_epi32(y, offset);
+  auto const j          = _mm512_cmplt_epu32_mask(_mm512_mullo_epi32(sum, multiplier), bound);
+  return _mm512_testn_epi32_mask(sum, _mm512_mask_blend_epi32(j, c3, c15));
+}
+
+// Processes 16 elements at a time. Hence, size must be a multiple of 16.
+[[gnu::target("avx512f,avx512bw")]]
+void last_day_of_month(year_t const* years, month_t const* months, size_t size, day_t* days) {
+
+  auto const c1  = _mm512_set1_epi32(1);
+  auto const c2  = _mm512_set1_epi32(2);
+  auto const c28 = _mm512_set1_epi32(28);
+  auto const c30 = _mm512_set1_epi32(30);
+
+  for (size_t i = 0; i < size; i += 16) {
+    auto const y = _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i const*)(years + i)));
+    auto const m = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i const*)(months + i)));
+    auto const o = _mm512_or_si512(_mm512_xor_si512(m, _mm512_srli_epi32(m, 3)), c30);
+    auto const f = _mm512_mask_add_epi32(c28, is_leap_year(y), c28, c1);
+    auto const d = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(m, c2), o, f);
+    _mm_storeu_si128((__m128i*)(days + i), _mm512_cvtepi32_epi8(d));
+  }
+}
 }
 
+#endif
+
 /*
  Code in next namespace is subject to the following terms.
 
@@ -171,3 +269,45 @@ auto const months = [](){
 DO_BENCHMARK(Boost, boost);
 DO_BENCHMARK(LibCxx, libcxx);
 DO_BENCHMARK(NeriSchneider, neri_schneider);
+
+#define DO_BATCH_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<day_t, 16384> days; \
+    for (auto _ : state) { \
+      namespace::last_day_of_month(years.data(), months.data(), years.size(), days.data()); \
+      benchmark::DoNotOptimize(days); \
+    } \
+  } \
+  BENCHMARK(label)
+
+// As DO_BATCH_BENCHMARK for kernels compiled for instructions that the CPU might lack.
+#define DO_SIMD_BENCHMARK(label, namespace, isa) \
+  void label(benchmark::State& state) { \
+    if (!supports_##isa()) { \
+      state.SkipWithError("Unsupported instructions."); \
+      return; \
+    } \
+    std::array<day_t, 16384> days; \
+    for (auto _ : state) { \
+      namespace::last_day_of_month(years.data(), months.data(), years.size(), days.data()); \
+      benchmark::DoNotOptimize(days); \
+    } \
+  } \
+  BENCHMARK(label)
+
+#if defined(__x86_64__)
+bool supports_avx2() {
+  return __builtin_cpu_supports("avx2");
+}
+
+bool supports_avx512() {
+  return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+}
+#endif
+
+DO_BATCH_BENCHMARK(NeriSchneider_Batch, neri_schneider);
+
+#if defined(__x86_64__)
+DO_SIMD_BENCHMARK(NeriSchneider_AVX2, neri_schneider::avx2, avx2);
+DO_SIMD_BENCHMARK(NeriSchneider_AVX512, neri_schneider::avx512, avx512);
+#endif
@@ -0,0 +1,323 @@
+/*
+ months_between benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+using rata_die_t = int32_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+// Rata dies are counted from 1970-Jan-01.
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+auto constexpr r2_e3 = uint32_t(536895458);
+
+bool is_leap_year(uint32_t y) {
+  return (y & (y % 100 == 0 ? 15 : 3)) == 0;
+}
+
+month_t last_day_of_month(uint32_t y, uint32_t m) {
+  return m != 2 ? ((m ^ (m >> 3))) | 30 : is_leap_year(y) ? 29 : 28;
+}
+
+date_t to_date(rata_die_t r) {
+
+  auto const r0 = r + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = 100 * q1 + q2 + j;
+  auto const m1 = j ? q3 - 12 : q3;
+  auto const d1 = r3 + 1;
+
+  return { year_t(y1), month_t(m1), day_t(d1) };
+}
+
+int32_t months_between(rata_die_t r0, rata_die_t r1) {
+
+  auto const u = to_date(r0);
+  auto const v = to_date(r1);
+
+  auto const k = 12 * (v.year - u.year) + v.month - u.month;
+  auto const e = (u.day > v.day) & (v.day != last_day_of_month(v.year, v.month));
+  auto const f = (v.day > u.day) & (u.day != last_day_of_month(u.year, u.month));
+
+  return k - int32_t((k > 0) & e) + int32_t((k < 0) & f);
+}
+
+void months_between(rata_die_t const* r0, rata_die_t const* r1, size_t size, int32_t* k) {
+  for (size_t i = 0; i < size; ++i)
+    k[i] = months_between(r0[i], r1[i]);
+}
+}
+
+namespace naive {
+
+// Howard Hinnant's civil_from_days (as used by std::chrono).
+date_t to_date(rata_die_t z) {
+  z += 719468;
+  auto const era = (z >= 0 ? z : z - 146096) / 146097;
+  auto const doe = unsigned(z - era * 146097);
+  auto const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  auto const y   = int(yoe) + era * 400;
+  auto const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  auto const mp  = (5 * doy + 2) / 153;
+  auto const d   = doy - (153 * mp + 2) / 5 + 1;
+  auto const m   = mp < 10 ? mp + 3 : mp - 9;
+  return {year_t(y + (m <= 2)), month_t(m), day_t(d)};
+}
+
+day_t last_day_of_month(year_t y, month_t m) {
+  day_t constexpr days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+  bool const leap = y % 4 == 0 && (y % 100 != 0 || y % 400 == 0);
+  return m == 2 && leap ? 29 : days[m - 1];
+}
+
+int32_t months_between(rata_die_t r0, rata_die_t r1) {
+  if (r1 < r0)
+    return -months_between(r1, r0);
+  auto const u = to_date(r0);
+  auto const v = to_date(r1);
+  auto       k = 12 * (v.year - u.year) + v.month - u.month;
+  if (v.day < u.day && v.day != last_day_of_month(v.year, v.month))
+    --k;
+  return k;
+}
+}
+
+namespace std_chrono {
+
+// Largest k such that u + months(k), clamped to the end of month, is not after v.
+int32_t months_between(rata_die_t r0, rata_die_t r1) {
+  using namespace std::chrono;
+  if (r1 < r0)
+    return -months_between(r1, r0);
+  auto const u = year_month_day(sys_days(days(r0)));
+  auto const v = year_month_day(sys_days(days(r1)));
+  auto       k = (v.year() - u.year()).count() * 12 +
+    int(unsigned(v.month())) - int(unsigned(u.month()));
+  auto w = u + months(k);
+  if (!w.ok())
+    w = w.year() / w.month() / last;
+  return sys_days(v) < sys_days(w) ? k - 1 : k;
+}
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+namespace neri_schneider::avx2 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx2")]]
+__m256i mulhi(__m256i a, uint32_t c) {
+  auto const b    = _mm256_set1_epi32(int(c));
+  auto const even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  auto const odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  return _mm256_blend_epi32(even, odd, 0b10101010);
+}
+
+[[gnu::target("avx2")]]
+__m256i is_leap_year(__m256i y) {
+  auto const sum  = _mm256_add_epi32(y, _mm256_set1_epi32(536870800));
+  auto const prod = _mm256_xor_si256(_mm256_mullo_epi32(sum, _mm256_set1_epi32(42949673)),
+    _mm256_set1_epi32(int(0x80000000)));
+  auto const j    = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(42949669 ^ 0x80000000)), prod);
+  auto const mask = _mm256_or_si256(_mm256_and_si256(j, _mm256_set1_epi32(12)),
+    _mm256_set1_epi32(3));
+  return _mm256_cmpeq_epi32(_mm256_and_si256(sum, mask), _mm256_setzero_si256());
+}
+
+[[gnu::target("avx2")]]
+__m256i last_day_of_month(__m256i y, __m256i m) {
+  auto const other    = _mm256_or_si256(_mm256_xor_si256(m, _mm256_srli_epi32(m, 3)),
+    _mm256_set1_epi32(30));
+  auto const february = _mm256_sub_epi32(_mm256_set1_epi32(28), is_leap_year(y));
+  return _mm256_blendv_epi8(other, february, _mm256_cmpeq_epi32(m, _mm256_set1_epi32(2)));
+}
+
+[[gnu::target("avx2")]]
+void to_date(__m256i r0, __m256i& y1, __m256i& m1, __m256i& d1) {
+
+  auto const c1      = _mm256_set1_epi32(1);
+  auto const c3      = _mm256_set1_epi32(3);
+  auto const c12     = _mm256_set1_epi32(12);
+  auto const c100    = _mm256_set1_epi32(100);
+  auto const c305    = _mm256_set1_epi32(305);
+  auto const c1461   = _mm256_set1_epi32(1461);
+  auto const c2141   = _mm256_set1_epi32(2141);
+  auto const c62690  = _mm256_set1_epi32(62690);
+  auto const c65535  = _mm256_set1_epi32(65535);
+  auto const c146097 = _mm256_set1_epi32(146097);
+  auto const c197913 = _mm256_set1_epi32(197913);
+
+  auto const n1 = _mm256_add_epi32(_mm256_slli_epi32(r0, 2), c3);
+  auto const q1 = _mm256_srli_epi32(mulhi(n1, 963315389), 15);
+  auto const r1 = _mm256_srli_epi32(_mm256_sub_epi32(n1, _mm256_mullo_epi32(q1, c146097)), 2);
+
+  auto const n2 = _mm256_or_si256(_mm256_slli_epi32(r1, 2), c3);
+  auto const q2 = mulhi(n2, 2939745);
+  auto const r2 = _mm256_srli_epi32(_mm256_sub_epi32(n2, _mm256_madd_epi16(q2, c1461)), 2);
+
+  auto const n3 = _mm256_add_epi32(_mm256_madd_epi16(r2, c2141), c197913);
+  auto const q3 = _mm256_srli_epi32(n3, 16);
+  auto const r3 = _mm256_srli_epi32(_mm256_mulhi_epu16(_mm256_and_si256(n3, c65535), c62690),
+    11);
+
+  auto const j  = _mm256_cmpgt_epi32(r2, c305);
+  y1 = _mm256_sub_epi32(_mm256_add_epi32(_mm256_madd_epi16(q1, c100), q2), j);
+  m1 = _mm256_sub_epi32(q3, _mm256_and_si256(j, c12));
+  d1 = _mm256_add_epi32(r3, c1);
+}
+
+// Processes 8 pairs of rata dies at a time. Hence, size must be a multiple of 8.
+[[gnu::target("avx2")]]
+void months_between(rata_die_t const* r0, rata_die_t const* r1, size_t size, int32_t* k) {
+
+  auto const cr = _mm256_set1_epi32(int(r2_e3));
+
+  for (size_t i = 0; i < size; i += 8) {
+
+    auto const a = _mm256_add_epi32(_mm256_loadu_si256((__m256i const*)(r0 + i)), cr);
+    auto const b = _mm256_add_epi32(_mm256_loadu_si256((__m256i const*)(r1 + i)), cr);
+    auto const s = _mm256_cmpgt_epi32(a, b);
+
+    __m256i y0, m0, d0, y1, m1, d1;
+    to_date(_mm256_min_epu32(a, b), y0, m0, d0);
+    to_date(_mm256_max_epu32(a, b), y1, m1, d1);
+
+    auto const dy = _mm256_sub_epi32(y1, y0);
+    auto const n  = _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(dy, 3),
+      _mm256_slli_epi32(dy, 2)), _mm256_sub_epi32(m1, m0));
+    auto const e  = _mm256_andnot_si256(_mm256_cmpeq_epi32(d1, last_day_of_month(y1, m1)),
+      _mm256_cmpgt_epi32(d0, d1));
+    auto const q  = _mm256_add_epi32(n, e);
+
+    _mm256_storeu_si256((__m256i*)(k + i), _mm256_sub_epi32(_mm256_xor_si256(q, s), s));
+  }
+}
+}
+
+#endif
+
+auto const rata_dies = [](){
+  std::uniform_int_distribution<rata_die_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<std::array<rata_die_t, 16384>, 2> rata_dies;
+  for (auto& n : rata_dies[0])
+    n = uniform_dist(rng);
+  for (auto& n : rata_dies[1])
+    n = uniform_dist(rng);
+  return rata_dies;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (std::size_t i = 0; i < rata_dies[0].size(); ++i) {
+        benchmark::DoNotOptimize(rata_dies[0][i]);
+        benchmark::DoNotOptimize(rata_dies[1][i]);
+      }
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (std::size_t i = 0; i < rata_dies[0].size(); ++i) { \
+        auto const k = namespace::months_between(rata_dies[0][i], rata_dies[1][i]); \
+        benchmark::DoNotOptimize(k); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+#define DO_BATCH_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<int32_t, 16384> results; \
+    for (auto _ : state) { \
+      namespace::months_between(rata_dies[0].data(), rata_dies[1].data(), \
+        rata_dies[0].size(), results.data()); \
+      benchmark::DoNotOptimize(results); \
+    } \
+  } \
+  BENCHMARK(label)
+
+// As DO_BATCH_BENCHMARK for kernels compiled for instructions that the CPU might lack.
+#define DO_SIMD_BENCHMARK(label, namespace, isa) \
+  void label(benchmark::State& state) { \
+    if (!supports_##isa()) { \
+      state.SkipWithError("Unsupported instructions."); \
+      return; \
+    } \
+    std::array<int32_t, 16384> results; \
+    for (auto _ : state) { \
+      namespace::months_between(rata_dies[0].data(), rata_dies[1].data(), \
+        rata_dies[0].size(), results.data()); \
+      benchmark::DoNotOptimize(results); \
+    } \
+  } \
+  BENCHMARK(label)
+
+#if defined(__x86_64__)
+bool supports_avx2() {
+  return __builtin_cpu_supports("avx2");
+}
+#endif
+
+DO_BENCHMARK(Naive, naive);
+DO_BENCHMARK(StdChrono, std_chrono);
+DO_BENCHMARK(NeriSchneider, neri_schneider);
+DO_BATCH_BENCHMARK(NeriSchneider_Batch, neri_schneider);
+
+#if defined(__x86_64__)
+DO_SIMD_BENCHMARK(NeriSchneider_AVX2, neri_schneider::avx2, avx2);
+#endif
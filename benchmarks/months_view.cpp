@@ -0,0 +1,157 @@
+/*
+ Month-stepping and year-stepping view benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+
+ Generates all months (and years) from 1600-Jan to 2399-Dec together with the
+ rata die (counted from 1970-Jan-01) of their first days and their lengths.
+ "Loop" benchmarks convert the first day of each month (year) by to_rata_die.
+*/
+
+#include <cstdint>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using rata_die_t = int32_t;
+
+struct month_info_t {
+  year_t     year;
+  month_t    month;
+  rata_die_t first;
+  rata_die_t length;
+};
+
+struct year_info_t {
+  year_t     year;
+  rata_die_t first;
+  rata_die_t length;
+};
+
+year_t constexpr first = 1600;
+year_t constexpr last  = 2400;
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+auto constexpr z2    = uint32_t(-1468000);
+auto constexpr r2_e3 = uint32_t(536895458);
+
+rata_die_t to_rata_die(uint32_t y, uint32_t m, uint32_t d) {
+
+  auto const y1 = y - z2;
+
+  auto const j  = m < 3;
+  auto const y0 = y1 - j;
+  auto const m0 = j ? m + 12 : m;
+  auto const d0 = d - 1;
+
+  auto const q1 = y0 / 100;
+  auto const yc = 1461 * y0 / 4 - q1 + q1 / 4;
+  auto const mc = (979 * m0 - 2919) / 32;
+
+  return rata_die_t(yc + mc + d0 - r2_e3);
+}
+
+bool is_leap_year(int32_t y) {
+  return (y & ((y % 100) == 0 ? 15 : 3)) == 0;
+}
+
+month_t last_day_of_month(int32_t y, month_t m) {
+  return m != 2 ? ((m ^ (m >> 3))) | 30 : is_leap_year(y) ? 29 : 28;
+}
+}
+
+namespace neri_schneider::view {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+// As months_view_t::iterator::length.
+rata_die_t length(year_t y, month_t m) {
+  auto const m0 = rata_die_t(m < 3 ? m + 12 : m);
+  if (m0 == 14)
+    return 28 + is_leap_year(y % 400);
+  return (979 * (m0 + 1) - 2919) / 32 - (979 * m0 - 2919) / 32;
+}
+
+template <typename F>
+void for_each_month(F f) {
+  auto n = neri_schneider::to_rata_die(first, 1, 1);
+  for (auto y = first; y != last; ++y) {
+    for (month_t m = 1; m <= 12; ++m) {
+      auto const l = length(y, m);
+      f(month_info_t{y, m, n, l});
+      n += l;
+    }
+  }
+}
+
+template <typename F>
+void for_each_year(F f) {
+  auto n = neri_schneider::to_rata_die(first, 1, 1);
+  for (auto y = first; y != last; ++y) {
+    auto const l = 365 + is_leap_year(y % 400);
+    f(year_info_t{y, n, l});
+    n += l;
+  }
+}
+}
+
+namespace neri_schneider::loop {
+
+template <typename F>
+void for_each_month(F f) {
+  for (auto y = first; y != last; ++y)
+    for (month_t m = 1; m <= 12; ++m)
+      f(month_info_t{y, m, neri_schneider::to_rata_die(y, m, 1),
+        neri_schneider::last_day_of_month(y, m)});
+}
+
+template <typename F>
+void for_each_year(F f) {
+  for (auto y = first; y != last; ++y) {
+    auto const n = neri_schneider::to_rata_die(y, 1, 1);
+    f(year_info_t{y, n, neri_schneider::to_rata_die(y + 1, 1, 1) - n});
+  }
+}
+}
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto y = first; y != last; ++y)
+        for (month_t m = 1; m <= 12; ++m)
+          benchmark::DoNotOptimize(m);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace, function, type) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      namespace::function([](type const& x) { \
+        benchmark::DoNotOptimize(x); \
+      }); \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(MonthsLoop, neri_schneider::loop, for_each_month, month_info_t);
+DO_BENCHMARK(MonthsView, neri_schneider::view, for_each_month, month_info_t);
+DO_BENCHMARK(YearsLoop, neri_schneider::loop, for_each_year, year_info_t);
+DO_BENCHMARK(YearsView, neri_schneider::view, for_each_year, year_info_t);
@@ -0,0 +1,116 @@
+/*
+ packed_date benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+
+using year_t  = int16_t;
+using month_t = uint8_t;
+using day_t   = uint8_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+namespace lexicographical {
+bool less(date_t const& u, date_t const& v) {
+  if (u.year  < v.year ) return true;
+  if (u.year  > v.year ) return false;
+  if (u.month < v.month) return true;
+  if (u.month > v.month) return false;
+  return u.day < v.day;
+}
+}
+
+struct packed_date_t {
+  uint32_t value;
+};
+
+namespace packed {
+packed_date_t pack(date_t const& u) {
+  return {uint32_t(uint16_t(u.year) ^ 0x8000) << 9 | uint32_t(u.month) << 5 | u.day};
+}
+bool less(packed_date_t const& u, packed_date_t const& v) {
+  return u.value < v.value;
+}
+}
+
+auto const dates = [](){
+  std::uniform_int_distribution<year_t>  year_dist(-400, 399);
+  std::uniform_int_distribution<month_t> month_dist(1, 12);
+  std::uniform_int_distribution<day_t>   day_dist(1, 28);
+  std::mt19937 rng;
+  std::array<date_t, 16384> dates;
+  for (auto& date : dates)
+    date = {year_dist(rng), month_dist(rng), day_dist(rng)};
+  return dates;
+}();
+
+auto const packed_dates = [](){
+  std::array<packed_date_t, 16384> packed_dates;
+  for (size_t i = 0; i < dates.size(); ++i)
+    packed_dates[i] = packed::pack(dates[i]);
+  return packed_dates;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (size_t i = 0; i + 1 < dates.size(); ++i)
+        benchmark::DoNotOptimize(i);
+  }
+  BENCHMARK(Scan);
+#endif
+
+// Compares consecutive dates.
+#define DO_COMPARE_BENCHMARK(label, namespace, dates) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (size_t i = 0; i + 1 < dates.size(); ++i) { \
+        auto const b = namespace::less(dates[i], dates[i + 1]); \
+        benchmark::DoNotOptimize(b); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+// Sorts a copy of the dates.
+#define DO_SORT_BENCHMARK(label, namespace, dates) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      auto copy = dates; \
+      std::sort(copy.begin(), copy.end(), namespace::less); \
+      benchmark::DoNotOptimize(copy); \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_COMPARE_BENCHMARK(Compare_Lexicographical, lexicographical, dates);
+DO_COMPARE_BENCHMARK(Compare_Packed, packed, packed_dates);
+
+DO_SORT_BENCHMARK(Sort_Lexicographical, lexicographical, dates);
+DO_SORT_BENCHMARK(Sort_Packed, packed, packed_dates);
@@ -0,0 +1,383 @@
+/*
+ Multi-threaded to_date and to_rata_die scaling benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+
+ Inputs (64 MiB of rata dies or dates) are much larger than the last level
+ cache. Each benchmark runs for 1 to std::thread::hardware_concurrency()
+ threads and reports items and bytes (read and written) per second of wall
+ clock time. Throughput stops growing when memory bandwidth saturates.
+
+ As in parallel.hpp, each chunk is converted by a batch kernel: "AVX2" cases
+ run the AVX2 copies of to_date.cpp and to_rata_die.cpp and "Scalar" cases run
+ the per-element functions.
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+using year_t     = int16_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+using rata_die_t = int32_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+size_t constexpr size  = size_t(1) << 24;
+size_t constexpr chunk = 16384;
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+auto constexpr z2    = uint32_t(-1468000);
+auto constexpr r2_e3 = uint32_t(536895458);
+
+date_t to_date(rata_die_t n) {
+
+  auto const r0 = uint32_t(n) + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = 100 * q1 + q2 + j;
+  auto const m1 = j ? q3 - 12 : q3;
+  auto const d1 = r3 + 1;
+
+  return { year_t(y1 + z2), month_t(m1), day_t(d1) };
+}
+
+rata_die_t to_rata_die(date_t const& u) {
+
+  auto const y1 = uint32_t(u.year) - z2;
+  auto const m1 = uint32_t(u.month);
+  auto const d1 = uint32_t(u.day);
+
+  auto const j  = uint32_t(m1 < 3);
+  auto const y0 = y1 - j;
+  auto const m0 = j ? m1 + 12 : m1;
+  auto const d0 = d1 - 1;
+
+  auto const q1 = y0 / 100;
+  auto const yc = 1461 * y0 / 4 - q1 + q1 / 4;
+  auto const mc = (979 * m0 - 2919) / 32;
+
+  return rata_die_t(yc + mc + d0 - r2_e3);
+}
+
+// https://github.com/cassioneri/calendar/blob/master/parallel.hpp
+
+class thread_pool_t {
+
+public:
+
+  explicit thread_pool_t(size_t size) : queues_(std::make_unique<queue_t[]>(size)) {
+    for (size_t w = 1; w < size; ++w)
+      threads_.emplace_back([this, w]() { loop(w); });
+  }
+
+  ~thread_pool_t() {
+    {
+      std::lock_guard lock{mutex_};
+      stop_ = true;
+    }
+    start_.notify_all();
+    for (auto& thread : threads_)
+      thread.join();
+  }
+
+  size_t size() const {
+    return threads_.size() + 1;
+  }
+
+  void run(size_t chunks, std::function<void(size_t)> task) {
+    auto const n = size();
+    for (size_t w = 0; w < n; ++w) {
+      std::lock_guard lock{queues_[w].mutex};
+      queues_[w].begin = chunks * w / n;
+      queues_[w].end   = chunks * (w + 1) / n;
+    }
+    {
+      std::lock_guard lock{mutex_};
+      task_ = std::move(task);
+      busy_ = threads_.size();
+      ++generation_;
+    }
+    start_.notify_all();
+    work(0);
+    std::unique_lock lock{mutex_};
+    done_.wait(lock, [this]() { return busy_ == 0; });
+  }
+
+private:
+
+  struct alignas(64) queue_t {
+    std::mutex mutex;
+    size_t     begin = 0;
+    size_t     end   = 0;
+  };
+
+  bool pop(size_t w, size_t& i) {
+    std::lock_guard lock{queues_[w].mutex};
+    if (queues_[w].begin == queues_[w].end)
+      return false;
+    i = queues_[w].begin++;
+    return true;
+  }
+
+  bool steal(size_t w, size_t& i) {
+    auto const n = size();
+    for (size_t k = 1; k < n; ++k) {
+      auto& queue = queues_[(w + k) % n];
+      std::lock_guard lock{queue.mutex};
+      if (queue.begin != queue.end) {
+        i = --queue.end;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void work(size_t w) {
+    size_t i;
+    while (pop(w, i) || steal(w, i))
+      task_(i);
+  }
+
+  void loop(size_t w) {
+    uint64_t generation = 0;
+    while (true) {
+      {
+        std::unique_lock lock{mutex_};
+        start_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+        if (stop_)
+          return;
+        generation = generation_;
+      }
+      work(w);
+      std::lock_guard lock{mutex_};
+      if (--busy_ == 0)
+        done_.notify_one();
+    }
+  }
+
+  std::unique_ptr<queue_t[]>   queues_;
+  std::vector<std::thread>     threads_;
+  std::function<void(size_t)>  task_;
+  std::mutex                   mutex_;
+  std::condition_variable      start_;
+  std::condition_variable      done_;
+  uint64_t                     generation_ = 0;
+  size_t                       busy_       = 0;
+  bool                         stop_       = false;
+};
+
+void to_date(rata_die_t const* r, size_t size, date_t* u) {
+  for (size_t i = 0; i < size; ++i)
+    u[i] = to_date(r[i]);
+}
+
+void to_rata_die(date_t const* u, size_t size, rata_die_t* r) {
+  for (size_t i = 0; i < size; ++i)
+    r[i] = to_rata_die(u[i]);
+}
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+namespace neri_schneider::avx2 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx2")]]
+__m256i mulhi(__m256i a, uint32_t c) {
+  auto const b    = _mm256_set1_epi32(int(c));
+  auto const even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  auto const odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  return _mm256_blend_epi32(even, odd, 0b10101010);
+}
+
+// Converts 8 rata dies at a time. Hence, size must be a multiple of 8.
+[[gnu::target("avx2")]]
+void to_date(rata_die_t const* r, size_t size, date_t* u) {
+
+  auto const c1      = _mm256_set1_epi32(1);
+  auto const c3      = _mm256_set1_epi32(3);
+  auto const c12     = _mm256_set1_epi32(12);
+  auto const c100    = _mm256_set1_epi32(100);
+  auto const c305    = _mm256_set1_epi32(305);
+  auto const c1461   = _mm256_set1_epi32(1461);
+  auto const c2141   = _mm256_set1_epi32(2141);
+  auto const c62690  = _mm256_set1_epi32(62690);
+  auto const c65535  = _mm256_set1_epi32(65535);
+  auto const c146097 = _mm256_set1_epi32(146097);
+  auto const c197913 = _mm256_set1_epi32(197913);
+  auto const cz2     = _mm256_set1_epi32(int(z2));
+  auto const cr2     = _mm256_set1_epi32(int(r2_e3));
+
+  for (size_t i = 0; i < size; i += 8) {
+
+    auto const r0 = _mm256_add_epi32(_mm256_loadu_si256((__m256i const*)(r + i)), cr2);
+
+    auto const n1 = _mm256_add_epi32(_mm256_slli_epi32(r0, 2), c3);
+    auto const q1 = _mm256_srli_epi32(mulhi(n1, 963315389), 15);
+    auto const r1 = _mm256_srli_epi32(_mm256_sub_epi32(n1, _mm256_mullo_epi32(q1, c146097)), 2);
+
+    auto const n2 = _mm256_or_si256(_mm256_slli_epi32(r1, 2), c3);
+    auto const q2 = mulhi(n2, 2939745);
+    auto const r2 = _mm256_srli_epi32(_mm256_sub_epi32(n2, _mm256_madd_epi16(q2, c1461)), 2);
+
+    auto const n3 = _mm256_add_epi32(_mm256_madd_epi16(r2, c2141), c197913);
+    auto const q3 = _mm256_srli_epi32(n3, 16);
+    auto const r3 = _mm256_srli_epi32(_mm256_mulhi_epu16(_mm256_and_si256(n3, c65535), c62690),
+      11);
+
+    auto const y0 = _mm256_add_epi32(_mm256_madd_epi16(q1, c100), q2);
+    auto const m0 = q3;
+    auto const d0 = r3;
+
+    auto const j  = _mm256_cmpgt_epi32(r2, c305);
+    auto const y1 = _mm256_sub_epi32(y0, j);
+    auto const m1 = _mm256_sub_epi32(m0, _mm256_and_si256(j, c12));
+    auto const d1 = _mm256_add_epi32(d0, c1);
+
+    // Each lane is day << 24 | month << 16 | year.
+    auto const y  = _mm256_and_si256(_mm256_add_epi32(y1, cz2), c65535);
+    auto const md = _mm256_or_si256(_mm256_slli_epi32(m1, 16), _mm256_slli_epi32(d1, 24));
+    _mm256_storeu_si256((__m256i*)(u + i), _mm256_or_si256(y, md));
+  }
+}
+
+// Converts 8 dates at a time. Hence, size must be a multiple of 8.
+[[gnu::target("avx2")]]
+void to_rata_die(date_t const* u2, size_t size, rata_die_t* r3) {
+
+  auto const c1    = _mm256_set1_epi32(1);
+  auto const c3    = _mm256_set1_epi32(3);
+  auto const c12   = _mm256_set1_epi32(12);
+  auto const c255  = _mm256_set1_epi32(255);
+  auto const c979  = _mm256_set1_epi32(979);
+  auto const c1461 = _mm256_set1_epi32(1461);
+  auto const c2919 = _mm256_set1_epi32(2919);
+  auto const cz2   = _mm256_set1_epi32(int(z2));
+  auto const cr2   = _mm256_set1_epi32(int(r2_e3));
+
+  for (size_t i = 0; i < size; i += 8) {
+
+    // Each lane is day << 24 | month << 16 | year.
+    auto const u  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(u2 + i));
+
+    auto const y1 = _mm256_sub_epi32(_mm256_srai_epi32(_mm256_slli_epi32(u, 16), 16), cz2);
+    auto const m1 = _mm256_and_si256(_mm256_srli_epi32(u, 16), c255);
+    auto const d1 = _mm256_srli_epi32(u, 24);
+
+    auto const j  = _mm256_cmpgt_epi32(c3, m1);
+    auto const y0 = _mm256_add_epi32(y1, j);
+    auto const m0 = _mm256_add_epi32(m1, _mm256_and_si256(j, c12));
+    auto const d0 = _mm256_sub_epi32(d1, c1);
+
+    auto const q1 = _mm256_srli_epi32(mulhi(y0, 1374389535), 5);
+    auto const yc = _mm256_add_epi32(_mm256_sub_epi32(
+      _mm256_srli_epi32(_mm256_mullo_epi32(y0, c1461), 2), q1), _mm256_srli_epi32(q1, 2));
+    auto const mc = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_madd_epi16(m0, c979), c2919), 5);
+    auto const dc = d0;
+
+    auto const r  = _mm256_sub_epi32(_mm256_add_epi32(_mm256_add_epi32(yc, mc), dc), cr2);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(r3 + i), r);
+  }
+}
+}
+
+#endif
+
+auto const rata_dies = [](){
+  std::uniform_int_distribution<rata_die_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::vector<rata_die_t> rata_dies(size);
+  for (auto& n : rata_dies)
+    n = uniform_dist(rng);
+  return rata_dies;
+}();
+
+auto const dates = [](){
+  std::vector<date_t> dates(size);
+  for (size_t i = 0; i < size; ++i)
+    dates[i] = neri_schneider::to_date(rata_dies[i]);
+  return dates;
+}();
+
+#include <benchmark/benchmark.h>
+
+// Chunk sizes are multiples of 8 as required by the AVX2 kernels.
+static_assert(size % chunk == 0 && chunk % 8 == 0);
+
+#define DO_BENCHMARK(label, namespace, function, input, output_t, supported) \
+  void label(benchmark::State& state) { \
+    if (!(supported)) { \
+      state.SkipWithError("Unsupported instructions."); \
+      return; \
+    } \
+    neri_schneider::thread_pool_t pool(size_t(state.range(0))); \
+    std::vector<output_t> output(size); \
+    for (auto _ : state) { \
+      pool.run(size / chunk, [&](size_t i) { \
+        namespace::function(input.data() + i * chunk, chunk, output.data() + i * chunk); \
+      }); \
+      benchmark::DoNotOptimize(output.data()); \
+      benchmark::ClobberMemory(); \
+    } \
+    state.SetItemsProcessed(state.iterations() * size); \
+    state.SetBytesProcessed(state.iterations() * size * (sizeof(input[0]) + sizeof(output_t))); \
+  } \
+  BENCHMARK(label)->DenseRange(1, std::max(std::thread::hardware_concurrency(), 1u)) \
+    ->UseRealTime()->Unit(benchmark::kMillisecond)
+
+DO_BENCHMARK(ToDate_Scalar, neri_schneider, to_date, rata_dies, date_t, true);
+DO_BENCHMARK(ToRataDie_Scalar, neri_schneider, to_rata_die, dates, rata_die_t, true);
+
+#if defined(__x86_64__)
+DO_BENCHMARK(ToDate_AVX2, neri_schneider::avx2, to_date, rata_dies, date_t,
+  __builtin_cpu_supports("avx2"));
+DO_BENCHMARK(ToRataDie_AVX2, neri_schneider::avx2, to_rata_die, dates, rata_die_t,
+  __builtin_cpu_supports("avx2"));
+#endif
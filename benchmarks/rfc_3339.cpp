@@ -0,0 +1,384 @@
+/*
+ RFC 3339 timestamp formatting and parsing benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+
+ Timestamps are nanoseconds since 1970-Jan-01 00:00:00 UTC written as, e.g.,
+ 2024-03-10T18:04:56.123456789+05:30. Benchmarks report throughput in bytes
+ per second of timestamps (including one new line per timestamp).
+*/
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+using rata_die_t = int32_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+// Longest timestamp (for 4 digit years) plus a new line.
+size_t constexpr max_size = 36;
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+auto constexpr z2    = uint32_t(-1468000);
+auto constexpr r2_e3 = uint32_t(536895458);
+auto constexpr p32   = uint64_t(1) << 32;
+
+date_t to_date(uint32_t r0) {
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = 100 * q1 + q2 + j;
+  auto const m1 = j ? q3 - 12 : q3;
+  auto const d1 = r3 + 1;
+
+  return { year_t(y1 + z2), month_t(m1), day_t(d1) };
+}
+
+rata_die_t to_rata_die(uint32_t y, uint32_t m, uint32_t d) {
+
+  auto const y1 = y - z2;
+
+  auto const j  = m < 3;
+  auto const y0 = y1 - j;
+  auto const m0 = j ? m + 12 : m;
+  auto const d0 = d - 1;
+
+  auto const q1 = y0 / 100;
+  auto const yc = 1461 * y0 / 4 - q1 + q1 / 4;
+  auto const mc = (979 * m0 - 2919) / 32;
+
+  return rata_die_t(yc + mc + d0 - r2_e3);
+}
+
+uint32_t last_day_of_month(uint32_t y, uint32_t m) {
+  return m != 2 ? ((m ^ (m >> 3))) | 30 : (y & (y % 100 == 0 ? 15 : 3)) == 0 ? 29 : 28;
+}
+
+uint64_t to_two_digits(uint64_t x) {
+  auto const t = (103 * x >> 10) & 0x000f000f000f000f;
+  auto const o = x - 10 * t;
+  return (t | o << 8) | 0x3030303030303030;
+}
+
+// Loads 8 characters as one 64-bit word.
+uint64_t load(char const* first) {
+  uint64_t w = 0;
+  for (unsigned i = 0; i < 8; ++i)
+    w |= uint64_t(uint8_t(first[i])) << 8 * i;
+  return w;
+}
+
+// Checks and converts pairs of digits of w in all byte lanes.
+bool swar(uint64_t w, uint64_t digits, uint64_t separators, uint64_t& p) {
+  auto const zeros = 0x3030303030303030 & digits;
+  auto const ok    = ((w & 0xf0f0f0f0f0f0f0f0 & digits) == zeros) &
+    (((w + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0 & digits) == zeros) &
+    ((w & ~digits) == separators);
+  auto const v = (w & digits) - zeros;
+  p = 10 * v + (v >> 8);
+  return ok;
+}
+
+char* format(char* first, int64_t t, int32_t offset) {
+
+  auto constexpr p = uint32_t(1000000000);
+  auto constexpr b = uint64_t(INT64_MAX / 86400 / p);
+
+  auto const u = uint64_t(t + int64_t(p) * 60 * offset) + 86400 * uint64_t(p) * b;
+  auto const q = uint64_t(__uint128_t(u >> 9) * 19342813113834067u >> 75);
+  auto       f = uint32_t(u - p * q);
+  auto const n = q / 86400;
+  auto const r = uint32_t(q - 86400 * n);
+
+  auto const v = to_date(uint32_t(n - b) + r2_e3);
+
+  auto const u1 = uint64_t(1193047) * r;
+  auto const h  = uint32_t(u1 / p32);
+  auto const r1 = uint32_t(u1 % p32) / 1193047;
+  auto const u2 = uint64_t(71582789) * r1;
+  auto const mi = uint32_t(u2 / p32);
+  auto const s  = uint32_t(u2 % p32) / 71582789;
+
+  auto const yh = uint32_t(v.year) * 5243 >> 19;
+  auto const yl = uint32_t(v.year) - 100 * yh;
+  auto const w1 = to_two_digits(yh | yl << 16 | uint64_t(v.month) << 32 | uint64_t(v.day) << 48);
+  auto const w2 = to_two_digits(h | mi << 16 | uint64_t(s) << 32);
+
+  first[ 0] = char(w1      );
+  first[ 1] = char(w1 >>  8);
+  first[ 2] = char(w1 >> 16);
+  first[ 3] = char(w1 >> 24);
+  first[ 4] = '-';
+  first[ 5] = char(w1 >> 32);
+  first[ 6] = char(w1 >> 40);
+  first[ 7] = '-';
+  first[ 8] = char(w1 >> 48);
+  first[ 9] = char(w1 >> 56);
+  first[10] = 'T';
+  first[11] = char(w2      );
+  first[12] = char(w2 >>  8);
+  first[13] = ':';
+  first[14] = char(w2 >> 16);
+  first[15] = char(w2 >> 24);
+  first[16] = ':';
+  first[17] = char(w2 >> 32);
+  first[18] = char(w2 >> 40);
+  first[19] = '.';
+
+  for (auto i = 9; i > 0; --i) {
+    auto const w = uint64_t(429496730) * f;
+    first[19 + i] = char('0' + uint32_t(w % p32) / 429496730);
+    f = uint32_t(w / p32);
+  }
+
+  if (offset == 0) {
+    first[29] = 'Z';
+    return first + 30;
+  }
+
+  auto const a  = uint32_t(offset < 0 ? -offset : offset);
+  auto const oh = a / 60;
+  auto const w3 = to_two_digits(oh | uint64_t(a - 60 * oh) << 16);
+
+  first[29] = offset < 0 ? '-' : '+';
+  first[30] = char(w3      );
+  first[31] = char(w3 >>  8);
+  first[32] = ':';
+  first[33] = char(w3 >> 16);
+  first[34] = char(w3 >> 24);
+
+  return first + 35;
+}
+
+char const* parse(char const* first, char const* last, int64_t& t) {
+
+  auto constexpr p = int64_t(1000000000);
+
+  if (last - first < 20)
+    return nullptr;
+
+  uint64_t pd, pt;
+  auto const ok_d = swar(load(first), 0x00ffff00ffffffff, 0x2d00002d00000000, pd);
+  auto const ok_t = swar(load(first + 11), 0xffff00ffff00ffff, 0x00003a00003a0000, pt);
+  auto const d0   = uint32_t(uint8_t(first[8]) - '0');
+  auto const d1   = uint32_t(uint8_t(first[9]) - '0');
+
+  auto const y  = 100 * uint32_t(pd & 0xff) + uint32_t(pd >> 16 & 0xff);
+  auto const m  = uint32_t(pd >> 40 & 0xff);
+  auto const d  = 10 * d0 + d1;
+  auto const h  = uint32_t(pt       & 0xff);
+  auto const mi = uint32_t(pt >> 24 & 0xff);
+  auto const s  = uint32_t(pt >> 48 & 0xff);
+
+  auto const ok = ok_d & ok_t & (d0 < 10) & (d1 < 10) & (first[10] == 'T') & (m - 1 < 12) &
+    (d - 1 < last_day_of_month(y, m)) & (h < 24) & (mi < 60) & (s < 60);
+
+  if (!ok)
+    return nullptr;
+
+  auto c = first + 19;
+
+  uint32_t f = 0;
+  if (*c == '.') {
+    auto const b = ++c;
+    for (; c != last && '0' <= *c && *c <= '9'; ++c)
+      if (c - b < 9)
+        f = 10 * f + uint32_t(*c - '0');
+    if (c == b)
+      return nullptr;
+    for (auto n = c - b; n < 9; ++n)
+      f *= 10;
+  }
+
+  if (c == last)
+    return nullptr;
+
+  int32_t o = 0;
+  if (*c == 'Z')
+    ++c;
+  else if ((*c == '+' || *c == '-') && last - c >= 6 && c[3] == ':') {
+    o  = 60 * (10 * (c[1] - '0') + (c[2] - '0')) + 10 * (c[4] - '0') + (c[5] - '0');
+    o  = *c == '-' ? -o : o;
+    c += 6;
+  }
+  else
+    return nullptr;
+
+  auto const n = int64_t(to_rata_die(y, m, d));
+  t = (86400 * n + 3600 * h + 60 * mi + s - 60 * o) * p + f;
+  return c;
+}
+}
+
+namespace c_stdio {
+
+char* format(char* first, int64_t t, int32_t offset) {
+
+  auto const u = t + int64_t(1000000000) * 60 * offset;
+  auto const s = u / 1000000000 - (u % 1000000000 < 0);
+  auto const f = long(u - s * 1000000000);
+  auto const a = offset < 0 ? -offset : offset;
+
+  time_t const tt = s;
+  std::tm tm;
+  gmtime_r(&tt, &tm);
+
+  auto const n = offset == 0 ?
+    std::snprintf(first, max_size, "%04d-%02d-%02dT%02d:%02d:%02d.%09ldZ", tm.tm_year + 1900,
+      tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, f) :
+    std::snprintf(first, max_size, "%04d-%02d-%02dT%02d:%02d:%02d.%09ld%c%02d:%02d",
+      tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, f,
+      offset < 0 ? '-' : '+', a / 60, a % 60);
+
+  return first + n;
+}
+
+char const* parse(char const* first, char const*, int64_t& t) {
+
+  std::tm tm = {};
+  long    f  = 0;
+  char    z  = 0;
+  int     oh = 0, om = 0, n = 0;
+
+  // Assumes 9 digits of fraction.
+  if (std::sscanf(first, "%4d-%2d-%2dT%2d:%2d:%2d.%9ld%c%n", &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+    &tm.tm_hour, &tm.tm_min, &tm.tm_sec, &f, &z, &n) != 8)
+    return nullptr;
+
+  auto c = first + n;
+  if (z == '+' || z == '-') {
+    if (std::sscanf(c, "%2d:%2d%n", &oh, &om, &n) != 2)
+      return nullptr;
+    c += n;
+  }
+  else if (z != 'Z')
+    return nullptr;
+
+  tm.tm_year -= 1900;
+  tm.tm_mon  -= 1;
+
+  auto const o = (z == '-' ? -1 : 1) * (60 * oh + om);
+  t = (int64_t(timegm(&tm)) - 60 * o) * 1000000000 + f;
+  return c;
+}
+}
+
+// Corpus generator: random timestamps from 1970 to 2100 with offsets from a small set, each
+// followed by a new line.
+struct corpus_t {
+  std::vector<int64_t> ticks;
+  std::vector<int32_t> offsets;
+  std::string          chars;
+};
+
+corpus_t const corpus = [](){
+
+  auto constexpr size = size_t(16384);
+
+  std::uniform_int_distribution<int64_t> uniform_ticks(0, int64_t(47482) * 86400 * 1000000000);
+  std::uniform_int_distribution<size_t>  uniform_offset(0, 7);
+  std::mt19937 rng;
+
+  int32_t constexpr offsets[] = { 0, 0, 0, 60, -300, 330, 540, -210 };
+
+  corpus_t corpus;
+  for (size_t i = 0; i < size; ++i) {
+
+    corpus.ticks  .push_back(uniform_ticks(rng));
+    corpus.offsets.push_back(offsets[uniform_offset(rng)]);
+
+    char buffer[max_size];
+    auto const end = c_stdio::format(buffer, corpus.ticks.back(), corpus.offsets.back());
+    corpus.chars.append(buffer, end);
+    corpus.chars.push_back('\n');
+  }
+  return corpus;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const c : corpus.chars)
+        benchmark::DoNotOptimize(c);
+    state.SetBytesProcessed(state.iterations() * corpus.chars.size());
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_FORMAT_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::vector<char> buffer(max_size * corpus.ticks.size()); \
+    for (auto _ : state) { \
+      auto c = buffer.data(); \
+      for (size_t i = 0; i < corpus.ticks.size(); ++i) { \
+        c    = namespace::format(c, corpus.ticks[i], corpus.offsets[i]); \
+        *c++ = '\n'; \
+      } \
+      benchmark::DoNotOptimize(buffer); \
+    } \
+    state.SetBytesProcessed(state.iterations() * corpus.chars.size()); \
+  } \
+  BENCHMARK(label)
+
+#define DO_PARSE_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      auto       c    = corpus.chars.data(); \
+      auto const last = c + corpus.chars.size(); \
+      while (c != last) { \
+        int64_t t = 0; \
+        c = namespace::parse(c, last, t) + 1; \
+        benchmark::DoNotOptimize(t); \
+      } \
+    } \
+    state.SetBytesProcessed(state.iterations() * corpus.chars.size()); \
+  } \
+  BENCHMARK(label)
+
+DO_FORMAT_BENCHMARK(Format_Snprintf, c_stdio);
+DO_FORMAT_BENCHMARK(Format_NeriSchneider, neri_schneider);
+DO_PARSE_BENCHMARK(Parse_Sscanf, c_stdio);
+DO_PARSE_BENCHMARK(Parse_NeriSchneider, neri_schneider);
@@ -0,0 +1,216 @@
+/*
+ to_chars (ISO 8601 date formatting) benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <sstream>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+// Large enough for "-2147483648-12-31".
+struct chars_t {
+  char chars[18];
+};
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+uint64_t to_two_digits(uint64_t x) {
+  auto const t = (103 * x >> 10) & 0x000f000f000f000f;
+  auto const o = x - 10 * t;
+  return (t | o << 8) | 0x3030303030303030;
+}
+
+char* to_chars(char* first, date_t const& u) {
+
+  auto const s = u.year < 0;
+  auto       n = s ? 0 - uint32_t(u.year) : uint32_t(u.year);
+
+  if (s || n > 9999) {
+
+    *first++ = s ? '-' : '+';
+
+    auto const q = n / 10000;
+    n -= 10000 * q;
+
+    char buffer[10];
+    auto c = std::end(buffer);
+
+    auto constexpr p32 = uint64_t(1) << 32;
+
+    for (auto p = q; p != 0; ) {
+      auto const w = uint64_t(429496730) * p;
+      *--c = char('0' + uint32_t(w % p32) / 429496730);
+      p = uint32_t(w / p32);
+    }
+
+    first = std::copy(c, std::end(buffer), first);
+  }
+
+  auto const h = n * 5243 >> 19;
+  auto const l = n - 100 * h;
+
+  auto const w = to_two_digits(uint64_t(h) | uint64_t(l) << 16 | uint64_t(u.month) << 32 |
+    uint64_t(u.day) << 48);
+
+  first[0] = char(w      );
+  first[1] = char(w >>  8);
+  first[2] = char(w >> 16);
+  first[3] = char(w >> 24);
+  first[4] = '-';
+  first[5] = char(w >> 32);
+  first[6] = char(w >> 40);
+  first[7] = '-';
+  first[8] = char(w >> 48);
+  first[9] = char(w >> 56);
+
+  return first + 10;
+}
+
+chars_t to_chars(date_t const& u) {
+  chars_t chars;
+  to_chars(chars.chars, u);
+  return chars;
+}
+
+// Formats all dates, each followed by a new line, into one contiguous buffer.
+char* to_chars(date_t const* u, size_t size, char* first) {
+  for (size_t i = 0; i < size; ++i) {
+    first    = to_chars(first, u[i]);
+    *first++ = '\n';
+  }
+  return first;
+}
+}
+
+namespace std_to_chars {
+
+char* to_chars_2(char* first, uint32_t n) {
+  if (n < 10)
+    *first++ = '0';
+  return std::to_chars(first, first + 2, n).ptr;
+}
+
+chars_t to_chars(date_t const& u) {
+  chars_t chars;
+  auto const last = std::end(chars.chars);
+  auto c = chars.chars;
+  auto const s = u.year < 0;
+  auto const n = s ? 0 - uint32_t(u.year) : uint32_t(u.year);
+  if (s || n > 9999)
+    *c++ = s ? '-' : '+';
+  for (auto p = n; p < 1000; p = 10 * p + 9)
+    *c++ = '0';
+  c    = std::to_chars(c, last, n).ptr;
+  *c++ = '-';
+  c    = to_chars_2(c, u.month);
+  *c++ = '-';
+  to_chars_2(c, u.day);
+  return chars;
+}
+}
+
+namespace c_snprintf {
+
+chars_t to_chars(date_t const& u) {
+  chars_t chars;
+  std::snprintf(chars.chars, sizeof(chars.chars), u.year < 0 || u.year > 9999 ?
+    "%+05d-%02u-%02u" : "%04d-%02u-%02u", u.year, unsigned(u.month), unsigned(u.day));
+  return chars;
+}
+}
+
+namespace std_ostream {
+
+chars_t to_chars(date_t const& u) {
+  std::ostringstream os;
+  os.fill('0');
+  os.width(4);
+  os << u.year << '-';
+  os.width(2);
+  os << unsigned(u.month) << '-';
+  os.width(2);
+  os << unsigned(u.day);
+  chars_t chars;
+  os.str().copy(chars.chars, sizeof(chars.chars) - 1);
+  return chars;
+}
+}
+
+auto const dates = [](){
+  std::uniform_int_distribution<uint32_t> uniform_dist(0, 28 * 12 * 400 - 1);
+  std::mt19937 rng;
+  std::array<date_t, 16384> dates;
+  for (auto& u : dates) {
+    auto const n = uniform_dist(rng);
+    u = { year_t(1800 + n / 28 / 12), month_t(n / 28 % 12 + 1), day_t(n % 28 + 1) };
+  }
+  return dates;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const& u : dates)
+        benchmark::DoNotOptimize(u);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (auto const& u : dates) { \
+        auto const chars = namespace::to_chars(u); \
+        benchmark::DoNotOptimize(chars); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+#define DO_BATCH_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<char, 11 * 16384> buffer; \
+    for (auto _ : state) { \
+      namespace::to_chars(dates.data(), dates.size(), buffer.data()); \
+      benchmark::DoNotOptimize(buffer); \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(StdOstream, std_ostream);
+DO_BENCHMARK(Snprintf, c_snprintf);
+DO_BENCHMARK(StdToChars, std_to_chars);
+DO_BENCHMARK(NeriSchneider, neri_schneider);
+DO_BATCH_BENCHMARK(NeriSchneider_Batch, neri_schneider);
@@ -71,6 +71,191 @@ date_t to_date(rata_die_t r) {
 }
 }
 
+namespace neri_schneider::u64 {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+// Full range of 64-bit rata dies: 4 * r0 + 3 might overflow and the division by 146097 is replaced
+// by an exact multiply-high on 128 bits.
+date_t to_date(rata_die_t r) {
+
+  auto constexpr z2    = uint64_t(-25252734927764400);
+  auto constexpr r2_e3 = uint64_t(9223372036854708335u);
+
+  auto const r0 = uint64_t(int64_t(r)) + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = uint64_t((__uint128_t(r0) * 4137408090565272301u + 3103056067923954226u) >> 77);
+  auto const r1 = uint32_t((n1 - 146097 * q1) / 4);
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const y0 = 100 * q1 + q2;
+  auto const m0 = q3;
+  auto const d0 = r3;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = y0 + j;
+  auto const m1 = j ? m0 - 12 : m0;
+  auto const d1 = d0 + 1;
+
+  return {year_t(y1 + z2), month_t(m1), day_t(d1)};
+}
+}
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+namespace neri_schneider::avx2 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx2")]]
+__m256i mulhi(__m256i a, uint32_t c) {
+  auto const b    = _mm256_set1_epi32(int(c));
+  auto const even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  auto const odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  return _mm256_blend_epi32(even, odd, 0b10101010);
+}
+
+// Converts 8 rata dies at a time. Hence, size must be a multiple of 8.
+[[gnu::target("avx2")]]
+void to_date(rata_die_t const* r, size_t size, date_t* u) {
+
+  auto constexpr z2    = uint32_t(-1468000);
+  auto constexpr r2_e3 = uint32_t(536895458);
+
+  auto const c1      = _mm256_set1_epi32(1);
+  auto const c3      = _mm256_set1_epi32(3);
+  auto const c12     = _mm256_set1_epi32(12);
+  auto const c100    = _mm256_set1_epi32(100);
+  auto const c305    = _mm256_set1_epi32(305);
+  auto const c1461   = _mm256_set1_epi32(1461);
+  auto const c2141   = _mm256_set1_epi32(2141);
+  auto const c62690  = _mm256_set1_epi32(62690);
+  auto const c65535  = _mm256_set1_epi32(65535);
+  auto const c146097 = _mm256_set1_epi32(146097);
+  auto const c197913 = _mm256_set1_epi32(197913);
+  auto const cz2     = _mm256_set1_epi32(int(z2));
+  auto const cr2     = _mm256_set1_epi32(int(r2_e3));
+
+  for (size_t i = 0; i < size; i += 8) {
+
+    auto const r0 = _mm256_add_epi32(_mm256_loadu_si256((__m256i const*)(r + i)), cr2);
+
+    auto const n1 = _mm256_add_epi32(_mm256_slli_epi32(r0, 2), c3);
+    auto const q1 = _mm256_srli_epi32(mulhi(n1, 963315389), 15);
+    auto const r1 = _mm256_srli_epi32(_mm256_sub_epi32(n1, _mm256_mullo_epi32(q1, c146097)), 2);
+
+    auto const n2 = _mm256_or_si256(_mm256_slli_epi32(r1, 2), c3);
+    auto const q2 = mulhi(n2, 2939745);
+    auto const r2 = _mm256_srli_epi32(_mm256_sub_epi32(n2, _mm256_madd_epi16(q2, c1461)), 2);
+
+    auto const n3 = _mm256_add_epi32(_mm256_madd_epi16(r2, c2141), c197913);
+    auto const q3 = _mm256_srli_epi32(n3, 16);
+    auto const r3 = _mm256_srli_epi32(_mm256_mulhi_epu16(_mm256_and_si256(n3, c65535), c62690),
+      11);
+
+    auto const y0 = _mm256_add_epi32(_mm256_madd_epi16(q1, c100), q2);
+    auto const m0 = q3;
+    auto const d0 = r3;
+
+    auto const j  = _mm256_cmpgt_epi32(r2, c305);
+    auto const y1 = _mm256_sub_epi32(y0, j);
+    auto const m1 = _mm256_sub_epi32(m0, _mm256_and_si256(j, c12));
+    auto const d1 = _mm256_add_epi32(d0, c1);
+
+    // Each lane is day << 24 | month << 16 | year.
+    auto const y  = _mm256_and_si256(_mm256_add_epi32(y1, cz2), c65535);
+    auto const md = _mm256_or_si256(_mm256_slli_epi32(m1, 16), _mm256_slli_epi32(d1, 24));
+    _mm256_storeu_si256((__m256i*)(u + i), _mm256_or_si256(y, md));
+  }
+}
+}
+
+#endif
+
+#if defined(__x86_64__)
+
+namespace neri_schneider::avx512 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx512f,avx512bw")]]
+__m512i mulhi(__m512i a, uint32_t c) {
+  auto const b    = _mm512_set1_epi32(int(c));
+  auto const even = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+  auto const odd  = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), b);
+  return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+
+// Converts 16 rata dies at a time. Hence, size must be a multiple of 16.
+[[gnu::target("avx512f,avx512bw")]]
+void to_date(rata_die_t const* r, size_t size, date_t* u) {
+
+  auto constexpr z2    = uint32_t(-1468000);
+  auto constexpr r2_e3 = uint32_t(536895458);
+
+  auto const c1      = _mm512_set1_epi32(1);
+  auto const c3      = _mm512_set1_epi32(3);
+  auto const c12     = _mm512_set1_epi32(12);
+  auto const c100    = _mm512_set1_epi32(100);
+  auto const c305    = _mm512_set1_epi32(305);
+  auto const c1461   = _mm512_set1_epi32(1461);
+  auto const c2141   = _mm512_set1_epi32(2141);
+  auto const c62690  = _mm512_set1_epi32(62690);
+  auto const c65535  = _mm512_set1_epi32(65535);
+  auto const c146097 = _mm512_set1_epi32(146097);
+  auto const c197913 = _mm512_set1_epi32(197913);
+  auto const cz2     = _mm512_set1_epi32(int(z2));
+  auto const cr2     = _mm512_set1_epi32(int(r2_e3));
+
+  for (size_t i = 0; i < size; i += 16) {
+
+    auto const r0 = _mm512_add_epi32(_mm512_loadu_si512(r + i), cr2);
+
+    auto const n1 = _mm512_add_epi32(_mm512_slli_epi32(r0, 2), c3);
+    auto const q1 = _mm512_srli_epi32(mulhi(n1, 963315389), 15);
+    auto const r1 = _mm512_srli_epi32(_mm512_sub_epi32(n1, _mm512_mullo_epi32(q1, c146097)), 2);
+
+    auto const n2 = _mm512_or_si512(_mm512_slli_epi32(r1, 2), c3);
+    auto const q2 = mulhi(n2, 2939745);
+    auto const r2 = _mm512_srli_epi32(_mm512_sub_epi32(n2, _mm512_madd_epi16(q2, c1461)), 2);
+
+    auto const n3 = _mm512_add_epi32(_mm512_madd_epi16(r2, c2141), c197913);
+    auto const q3 = _mm512_srli_epi32(n3, 16);
+    auto const r3 = _mm512_srli_epi32(_mm512_mulhi_epu16(_mm512_and_si512(n3, c65535), c62690),
+      11);
+
+    auto const y0 = _mm512_add_epi32(_mm512_madd_epi16(q1, c100), q2);
+    auto const m0 = q3;
+    auto const d0 = r3;
+
+    auto const j  = _mm512_cmpgt_epu32_mask(r2, c305);
+    auto const y1 = _mm512_mask_add_epi32(y0, j, y0, c1);
+    auto const m1 = _mm512_mask_sub_epi32(m0, j, m0, c12);
+    auto const d1 = _mm512_add_epi32(d0, c1);
+
+    // Each lane is day << 24 | month << 16 | year.
+    auto const y  = _mm512_and_si512(_mm512_add_epi32(y1, cz2), c65535);
+    auto const md = _mm512_or_si512(_mm512_slli_epi32(m1, 16), _mm512_slli_epi32(d1, 24));
+    _mm512_storeu_si512(u + i, _mm512_or_si512(y, md));
+  }
+}
+}
+
+#endif
+
 namespace baum {
 
 // https://tinyurl.com/y44rgx2j
@@ -553,6 +738,43 @@ auto const rata_dies = [](){
   } \
   BENCHMARK(label)
 
+#define DO_BATCH_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<date_t, 16384> dates; \
+    for (auto _ : state) { \
+      namespace::to_date(rata_dies.data(), rata_dies.size(), dates.data()); \
+      benchmark::DoNotOptimize(dates); \
+    } \
+    state.SetItemsProcessed(state.iterations() * rata_dies.size()); \
+  } \
+  BENCHMARK(label)
+
+// As DO_BATCH_BENCHMARK for kernels compiled for instructions that the CPU might lack.
+#define DO_SIMD_BENCHMARK(label, namespace, isa) \
+  void label(benchmark::State& state) { \
+    if (!supports_##isa()) { \
+      state.SkipWithError("Unsupported instructions."); \
+      return; \
+    } \
+    std::array<date_t, 16384> dates; \
+    for (auto _ : state) { \
+      namespace::to_date(rata_dies.data(), rata_dies.size(), dates.data()); \
+      benchmark::DoNotOptimize(dates); \
+    } \
+    state.SetItemsProcessed(state.iterations() * rata_dies.size()); \
+  } \
+  BENCHMARK(label)
+
+#if defined(__x86_64__)
+bool supports_avx2() {
+  return __builtin_cpu_supports("avx2");
+}
+
+bool supports_avx512() {
+  return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+}
+#endif
+
 DO_BENCHMARK(Baum, baum);
 DO_BENCHMARK(Boost, boost);
 DO_BENCHMARK(DotNet, dotnet);
@@ -563,3 +785,9 @@ DO_BENCHMARK(LibCxx, libcxx);
 DO_BENCHMARK(OpenJDK, openjdk);
 DO_BENCHMARK(ReingoldDershowitz, reingold_dershowitz);
 DO_BENCHMARK(NeriSchneider, neri_schneider);
+DO_BENCHMARK(NeriSchneider_U64, neri_schneider::u64);
+
+#if defined(__x86_64__)
+DO_SIMD_BENCHMARK(NeriSchneider_AVX2, neri_schneider::avx2, avx2);
+DO_SIMD_BENCHMARK(NeriSchneider_AVX512, neri_schneider::avx512, avx512);
+#endif
@@ -0,0 +1,187 @@
+/*
+ Sorted-input to_date benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+
+ Rata dies are counted from 1970-Jan-01 and drawn uniformly from the window
+ [2000-Jan-01, 2002-Sep-26] (1000 days, about 16 rata dies per day). "Sorted"
+ inputs are in ascending order, "NearlySorted" inputs are sorted with 1% of
+ them replaced by random ones and "Random" inputs are not sorted.
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+using rata_die_t = int32_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+date_t to_date(rata_die_t n) {
+
+  auto constexpr z2    = uint32_t(-1468000);
+  auto constexpr r2_e3 = uint32_t(536895458);
+
+  auto const r0 = uint32_t(n) + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = 100 * q1 + q2 + j;
+  auto const m1 = j ? q3 - 12 : q3;
+  auto const d1 = r3 + 1;
+
+  return { year_t(y1 + z2), month_t(m1), day_t(d1) };
+}
+
+bool is_leap_year(int32_t y) {
+  return (y & ((y % 100) == 0 ? 15 : 3)) == 0;
+}
+
+month_t last_day_of_month(int32_t y, month_t m) {
+  return m != 2 ? ((m ^ (m >> 3))) | 30 : is_leap_year(y) ? 29 : 28;
+}
+
+template <size_t N>
+void to_date(std::array<rata_die_t, N> const& ns, std::array<date_t, N>& us) {
+  for (size_t i = 0; i < N; ++i)
+    us[i] = to_date(ns[i]);
+}
+}
+
+namespace neri_schneider::sorted {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+template <size_t N>
+void to_date(std::array<rata_die_t, N> const& ns, std::array<date_t, N>& us) {
+
+  auto u      = date_t{};
+  auto first  = rata_die_t(0);
+  auto length = uint32_t(0);
+
+  for (size_t i = 0; i < N; ++i) {
+
+    auto const n = ns[i];
+
+    if (uint32_t(n) - uint32_t(first) >= length) {
+
+      auto const next_first  = rata_die_t(uint32_t(first) + length);
+      auto const carry       = u.month == 12;
+      auto const next_year   = year_t(carry ? u.year + 1 : u.year);
+      auto const next_month  = month_t(carry ? 1 : u.month + 1);
+      auto const next_length = uint32_t(last_day_of_month(next_year % 400, next_month));
+
+      if (length != 0 && uint32_t(n) - uint32_t(next_first) < next_length) {
+        u.year  = next_year;
+        u.month = next_month;
+        first   = next_first;
+        length  = next_length;
+      }
+      else {
+        u      = neri_schneider::to_date(n);
+        first  = n - (u.day - 1);
+        length = last_day_of_month(u.year % 400, u.month);
+      }
+    }
+
+    us[i] = { u.year, u.month, day_t(uint32_t(n) - uint32_t(first) + 1) };
+  }
+}
+}
+
+size_t constexpr size = 16384;
+
+rata_die_t constexpr window_first = 10957; // 2000-Jan-01
+rata_die_t constexpr window_last  = 11956; // 2002-Sep-26
+
+auto const random_rata_dies = [](){
+  std::uniform_int_distribution<rata_die_t> uniform_dist(window_first, window_last);
+  std::mt19937 rng;
+  std::array<rata_die_t, size> ns;
+  for (auto& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+auto const sorted_rata_dies = [](){
+  auto ns = random_rata_dies;
+  std::sort(ns.begin(), ns.end());
+  return ns;
+}();
+
+auto const nearly_sorted_rata_dies = [](){
+  std::uniform_int_distribution<rata_die_t> uniform_dist(window_first, window_last);
+  std::mt19937 rng;
+  auto ns = sorted_rata_dies;
+  for (size_t i = 0; i < size; i += 100)
+    ns[i] = uniform_dist(rng);
+  return ns;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const& n : sorted_rata_dies)
+        benchmark::DoNotOptimize(n);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, input, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<date_t, size> us; \
+    for (auto _ : state) { \
+      namespace::to_date(input, us); \
+      benchmark::DoNotOptimize(us.data()); \
+      benchmark::ClobberMemory(); \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(Sorted_NeriSchneider, sorted_rata_dies, neri_schneider);
+DO_BENCHMARK(Sorted_Sorted, sorted_rata_dies, neri_schneider::sorted);
+DO_BENCHMARK(NearlySorted_NeriSchneider, nearly_sorted_rata_dies, neri_schneider);
+DO_BENCHMARK(NearlySorted_Sorted, nearly_sorted_rata_dies, neri_schneider::sorted);
+DO_BENCHMARK(Random_NeriSchneider, random_rata_dies, neri_schneider);
+DO_BENCHMARK(Random_Sorted, random_rata_dies, neri_schneider::sorted);
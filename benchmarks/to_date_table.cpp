@@ -0,0 +1,194 @@
+/*
+ Table-assisted to_date benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+
+ Rata dies are counted from 1970-Jan-01 and dates are uniformly distributed in
+ the window [1900-Jan-01, 2100-Dec-31] of table_to_date_t. "Isolated"
+ benchmarks only convert rata dies. "Mixed" benchmarks also evaluate a chain of
+ multiplications per rata die (as other work on the same row would) which
+ competes with to_date for the multiplier.
+*/
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+using rata_die_t = int32_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+auto constexpr z2    = uint32_t(-1468000);
+auto constexpr r2_e3 = uint32_t(536895458);
+
+date_t to_date(rata_die_t r) {
+
+  auto const r0 = r + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const y0 = 100 * q1 + q2;
+  auto const m0 = q3;
+  auto const d0 = r3;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = y0 + j;
+  auto const m1 = j ? m0 - 12 : m0;
+  auto const d1 = d0 + 1;
+
+  return {year_t(y1 + z2), month_t(m1), day_t(d1)};
+}
+
+rata_die_t to_rata_die(uint32_t y, uint32_t m, uint32_t d) {
+
+  auto const y1 = y - z2;
+
+  auto const j  = m < 3;
+  auto const y0 = y1 - j;
+  auto const m0 = j ? m + 12 : m;
+  auto const d0 = d - 1;
+
+  auto const q1 = y0 / 100;
+  auto const yc = 1461 * y0 / 4 - q1 + q1 / 4;
+  auto const mc = (979 * m0 - 2919) / 32;
+
+  return rata_die_t(yc + mc + d0 - r2_e3);
+}
+}
+
+namespace neri_schneider::table {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+int32_t constexpr first = 1900;
+int32_t constexpr last  = 2100;
+
+// Rata dies of March 1st of years first - 1 to last + 1.
+auto const year_starts = [](){
+  std::array<rata_die_t, last - first + 3> t;
+  for (size_t i = 0; i < t.size(); ++i)
+    t[i] = neri_schneider::to_rata_die(first - 1 + i, 3, 1);
+  return t;
+}();
+
+date_t to_date(rata_die_t n) {
+
+  auto const d = uint32_t(n) - uint32_t(year_starts.front());
+
+  if (d >= uint32_t(year_starts.back() - year_starts.front()))
+    return neri_schneider::to_date(n);
+
+  auto const e  = d / 365;
+  auto const k  = e - (n < year_starts[e]);
+  auto const r2 = uint32_t(n - year_starts[k]);
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = first - 1 + int32_t(k) + j;
+  auto const m1 = j ? q3 - 12 : q3;
+  auto const d1 = r3 + 1;
+
+  return {year_t(y1), month_t(m1), day_t(d1)};
+}
+}
+
+namespace naive {
+
+// Other work on the same row: a chain of multiplications.
+uint32_t work(uint32_t x) {
+  for (int i = 0; i < 4; ++i)
+    x = x * 2654435761u + 0x9e3779b9;
+  return x;
+}
+}
+
+auto const rata_dies = [](){
+  std::uniform_int_distribution<rata_die_t> uniform_dist(
+    neri_schneider::to_rata_die(1900, 1, 1), neri_schneider::to_rata_die(2100, 12, 31));
+  std::mt19937 rng;
+  std::array<rata_die_t, 16384> ns;
+  for (auto& n : ns)
+    n = uniform_dist(rng);
+  return ns;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const& n : rata_dies)
+        benchmark::DoNotOptimize(n);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (auto const& n : rata_dies) { \
+        auto const u = namespace::to_date(n); \
+        benchmark::DoNotOptimize(u); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+#define DO_MIXED_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (auto const& n : rata_dies) { \
+        auto const u = namespace::to_date(n); \
+        auto const w = naive::work(uint32_t(n)); \
+        benchmark::DoNotOptimize(u); \
+        benchmark::DoNotOptimize(w); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(Isolated_NeriSchneider, neri_schneider);
+DO_BENCHMARK(Isolated_Table, neri_schneider::table);
+DO_MIXED_BENCHMARK(Mixed_NeriSchneider, neri_schneider);
+DO_MIXED_BENCHMARK(Mixed_Table, neri_schneider::table);
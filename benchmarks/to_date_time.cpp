@@ -0,0 +1,152 @@
+/*
+ to_date_time benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <random>
+
+using year_t    = int16_t;
+using month_t   = uint8_t;
+using day_t     = uint8_t;
+using seconds_t = int64_t;
+
+struct date_time_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t second;
+};
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+date_time_t to_date_time(seconds_t s) {
+
+  auto constexpr days_offset = uint64_t(INT64_MAX / 86400);
+
+  auto const u  = uint64_t(s) + 86400 * days_offset;
+  auto const n  = u / 86400;
+  auto const n0 = uint32_t(u - 86400 * n);
+
+  auto constexpr z2    = uint32_t(-1468000);
+  auto constexpr r2_e3 = uint32_t(536895458);
+
+  auto const r0 = uint32_t(n - days_offset) + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const y0 = 100 * q1 + q2;
+  auto const m0 = q3;
+  auto const d0 = r3;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = y0 + j;
+  auto const m1 = j ? m0 - 12 : m0;
+  auto const d1 = d0 + 1;
+
+  auto const u4 = uint64_t(1193047) * n0;
+  auto const h  = uint32_t(u4 / p32);
+  auto const r4 = uint32_t(u4 % p32) / 1193047;
+
+  auto const u5 = uint64_t(71582789) * r4;
+  auto const mi = uint32_t(u5 / p32);
+  auto const se = uint32_t(u5 % p32) / 71582789;
+
+  return {year_t(y1 + z2), month_t(m1), day_t(d1), uint8_t(h), uint8_t(mi), uint8_t(se)};
+}
+
+void to_date_time(seconds_t const* s, size_t size, date_time_t* u) {
+  for (size_t i = 0; i < size; ++i)
+    u[i] = to_date_time(s[i]);
+}
+}
+
+namespace glibc {
+
+date_time_t to_date_time(seconds_t s) {
+  auto const t = time_t(s);
+  tm u;
+  gmtime_r(&t, &u);
+  return {year_t(u.tm_year + 1900), month_t(u.tm_mon + 1), day_t(u.tm_mday), uint8_t(u.tm_hour),
+    uint8_t(u.tm_min), uint8_t(u.tm_sec)};
+}
+}
+
+auto const seconds = [](){
+  std::uniform_int_distribution<seconds_t> uniform_dist(-146097 * seconds_t(86400),
+    146097 * seconds_t(86400) - 1);
+  std::mt19937 rng;
+  std::array<seconds_t, 16384> seconds;
+  for (auto& s : seconds)
+    s = uniform_dist(rng);
+  return seconds;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const s : seconds)
+        benchmark::DoNotOptimize(s);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (auto const s : seconds) { \
+        auto const date_time = namespace::to_date_time(s); \
+        benchmark::DoNotOptimize(date_time); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+#define DO_BATCH_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<date_time_t, 16384> date_times; \
+    for (auto _ : state) { \
+      namespace::to_date_time(seconds.data(), seconds.size(), date_times.data()); \
+      benchmark::DoNotOptimize(date_times); \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(GLibC, glibc);
+DO_BENCHMARK(NeriSchneider, neri_schneider);
+DO_BATCH_BENCHMARK(NeriSchneider_Batch, neri_schneider);
@@ -0,0 +1,172 @@
+/*
+ to_precise_date_time benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+using year_t  = int16_t;
+using month_t = uint8_t;
+using day_t   = uint8_t;
+
+struct precise_date_time_t {
+  year_t   year;
+  month_t  month;
+  day_t    day;
+  uint8_t  hour;
+  uint8_t  minute;
+  uint8_t  second;
+  uint32_t fraction;
+};
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+date_t to_date(uint32_t r0) {
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const y0 = 100 * q1 + q2;
+  auto const m0 = q3;
+  auto const d0 = r3;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = y0 + j;
+  auto const m1 = j ? m0 - 12 : m0;
+  auto const d1 = d0 + 1;
+
+  return {year_t(y1 - 1468000), month_t(m1), day_t(d1)};
+}
+
+auto constexpr r2_e3 = uint32_t(536895458);
+
+namespace ubiquitous {
+
+template <uint32_t p>
+precise_date_time_t to_precise_date_time(int64_t t) {
+
+  auto const s = t / p - (t % p < 0);
+  auto const f = uint32_t(t - p * s);
+
+  auto const n = s / 86400 - (s % 86400 < 0);
+  auto const r = uint32_t(s - 86400 * n);
+
+  auto const u = to_date(uint32_t(n) + r2_e3);
+
+  return {u.year, u.month, u.day, uint8_t(r / 3600), uint8_t(r % 3600 / 60), uint8_t(r % 60), f};
+}
+}
+
+namespace neri_schneider {
+
+template <uint32_t p>
+uint64_t ticks_to_seconds(uint64_t n) {
+  auto constexpr s     = p == 1000 ? 3 : p == 1000000 ? 6 : 9;
+  auto constexpr k     = p == 1000 ? 68 : p == 1000000 ? 71 : 75;
+  auto constexpr alpha = p == 1000 ? 2361183241434822607u : p == 1000000 ? 151115727451828647u :
+    19342813113834067u;
+  return uint64_t(__uint128_t(n >> s) * alpha >> k);
+}
+
+template <uint32_t p>
+precise_date_time_t to_precise_date_time(int64_t t) {
+
+  auto constexpr b = uint64_t(INT64_MAX / 86400 / p);
+
+  auto const u = uint64_t(t) + 86400 * uint64_t(p) * b;
+  auto const q = ticks_to_seconds<p>(u);
+  auto const f = uint32_t(u - p * q);
+
+  auto const n = q / 86400;
+  auto const r = uint32_t(q - 86400 * n);
+
+  auto const v = to_date(uint32_t(n - b) + r2_e3);
+
+  auto constexpr p32 = uint64_t(1) << 32;
+
+  auto const u1 = uint64_t(1193047) * r;
+  auto const h  = uint32_t(u1 / p32);
+  auto const r1 = uint32_t(u1 % p32) / 1193047;
+
+  auto const u2 = uint64_t(71582789) * r1;
+  auto const m  = uint32_t(u2 / p32);
+  auto const s  = uint32_t(u2 % p32) / 71582789;
+
+  return {v.year, v.month, v.day, uint8_t(h), uint8_t(m), uint8_t(s), f};
+}
+}
+
+// Random ticks within +/- 200 years from the epoch. (Nanoseconds are limited to +/- 292 years.)
+template <uint32_t p>
+auto const ticks = [](){
+  std::uniform_int_distribution<int64_t> uniform_dist(-int64_t(73048) * 86400 * p,
+    int64_t(73048) * 86400 * p);
+  std::mt19937 rng;
+  std::array<int64_t, 16384> ticks;
+  for (auto& t : ticks)
+    t = uniform_dist(rng);
+  return ticks;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const t : ticks<1000000000>)
+        benchmark::DoNotOptimize(t);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace, p) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (auto const t : ticks<p>) { \
+        auto const date_time = namespace::to_precise_date_time<p>(t); \
+        benchmark::DoNotOptimize(date_time); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(Ubiquitous_Milliseconds, ubiquitous, 1000);
+DO_BENCHMARK(NeriSchneider_Milliseconds, neri_schneider, 1000);
+DO_BENCHMARK(Ubiquitous_Microseconds, ubiquitous, 1000000);
+DO_BENCHMARK(NeriSchneider_Microseconds, neri_schneider, 1000000);
+DO_BENCHMARK(Ubiquitous_Nanoseconds, ubiquitous, 1000000000);
+DO_BENCHMARK(NeriSchneider_Nanoseconds, neri_schneider, 1000000000);
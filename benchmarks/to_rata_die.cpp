@@ -61,6 +61,68 @@ rata_die_t to_rata_die(date_t const& u2) {
 }
 }
 
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+namespace neri_schneider::avx2 {
+
+// https://github.com/cassioneri/calendar/blob/master/simd.hpp
+
+[[gnu::target("avx2")]]
+__m256i mulhi(__m256i a, uint32_t c) {
+  auto const b    = _mm256_set1_epi32(int(c));
+  auto const even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  auto const odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  return _mm256_blend_epi32(even, odd, 0b10101010);
+}
+
+// Converts 8 dates at a time. Hence, size must be a multiple of 8.
+[[gnu::target("avx2")]]
+void to_rata_die(date_t const* u2, size_t size, rata_die_t* r3) {
+
+  auto constexpr z2    = uint32_t(-1468000);
+  auto constexpr r2_e3 = uint32_t(536895458);
+
+  auto const c1    = _mm256_set1_epi32(1);
+  auto const c3    = _mm256_set1_epi32(3);
+  auto const c12   = _mm256_set1_epi32(12);
+  auto const c255  = _mm256_set1_epi32(255);
+  auto const c979  = _mm256_set1_epi32(979);
+  auto const c1461 = _mm256_set1_epi32(1461);
+  auto const c2919 = _mm256_set1_epi32(2919);
+  auto const cz2   = _mm256_set1_epi32(int(z2));
+  auto const cr2   = _mm256_set1_epi32(int(r2_e3));
+
+  for (size_t i = 0; i < size; i += 8) {
+
+    // Each lane is day << 24 | month << 16 | year.
+    auto const u  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(u2 + i));
+
+    auto const y1 = _mm256_sub_epi32(_mm256_srai_epi32(_mm256_slli_epi32(u, 16), 16), cz2);
+    auto const m1 = _mm256_and_si256(_mm256_srli_epi32(u, 16), c255);
+    auto const d1 = _mm256_srli_epi32(u, 24);
+
+    auto const j  = _mm256_cmpgt_epi32(c3, m1);
+    auto const y0 = _mm256_add_epi32(y1, j);
+    auto const m0 = _mm256_add_epi32(m1, _mm256_and_si256(j, c12));
+    auto const d0 = _mm256_sub_epi32(d1, c1);
+
+    auto const q1 = _mm256_srli_epi32(mulhi(y0, 1374389535), 5);
+    auto const yc = _mm256_add_epi32(_mm256_sub_epi32(
+      _mm256_srli_epi32(_mm256_mullo_epi32(y0, c1461), 2), q1), _mm256_srli_epi32(q1, 2));
+    auto const mc = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_madd_epi16(m0, c979), c2919), 5);
+    auto const dc = d0;
+
+    auto const r  = _mm256_sub_epi32(_mm256_add_epi32(_mm256_add_epi32(yc, mc), dc), cr2);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(r3 + i), r);
+  }
+}
+}
+
+#endif
+
 namespace baum {
 
 // https://tinyurl.com/y44rgx2j
@@ -517,3 +579,18 @@ DO_BENCHMARK(LibCxx, libcxx);
 DO_BENCHMARK(OpenJDK, openjdk);
 DO_BENCHMARK(ReingoldDershowitz, reingold_dershowitz);
 DO_BENCHMARK(NeriSchneider, neri_schneider);
+
+#if defined(__x86_64__)
+  void NeriSchneider_AVX2(benchmark::State& state) {
+    if (!__builtin_cpu_supports("avx2")) {
+      state.SkipWithError("Unsupported instructions.");
+      return;
+    }
+    std::array<rata_die_t, 16384> rata_dies;
+    for (auto _ : state) {
+      neri_schneider::avx2::to_rata_die(dates.data(), dates.size(), rata_dies.data());
+      benchmark::DoNotOptimize(rata_dies);
+    }
+  }
+  BENCHMARK(NeriSchneider_AVX2);
+#endif
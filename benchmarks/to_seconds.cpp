@@ -0,0 +1,137 @@
+/*
+ to_seconds benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <random>
+
+using year_t    = int16_t;
+using month_t   = uint8_t;
+using day_t     = uint8_t;
+using seconds_t = int64_t;
+
+struct date_time_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t second;
+};
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+seconds_t to_seconds(date_time_t const& u) {
+
+  auto constexpr z2    = uint32_t(-1468000);
+  auto constexpr r2_e3 = uint32_t(536895458);
+
+  auto const y1 = uint32_t(u.year) - z2;
+  auto const m1 = uint32_t(u.month);
+  auto const d1 = uint32_t(u.day);
+
+  auto const j  = uint32_t(m1 < 3);
+  auto const y0 = y1 - j;
+  auto const m0 = j ? m1 + 12 : m1;
+  auto const d0 = d1 - 1;
+
+  auto const q1 = y0 / 100;
+  auto const yc = 1461 * y0 / 4 - q1 + q1 / 4;
+  auto const mc = (979 * m0 - 2919) / 32;
+  auto const dc = d0;
+
+  auto const n  = yc + mc + dc - r2_e3;
+  auto const t  = 3600 * uint32_t(u.hour) + 60 * uint32_t(u.minute) + uint32_t(u.second);
+
+  return seconds_t(86400 * uint64_t(int64_t(int32_t(n))) + t);
+}
+
+void to_seconds(date_time_t const* u, size_t size, seconds_t* s) {
+  for (size_t i = 0; i < size; ++i)
+    s[i] = to_seconds(u[i]);
+}
+}
+
+namespace glibc {
+
+seconds_t to_seconds(date_time_t const& u) {
+  tm t = {};
+  t.tm_year = u.year - 1900;
+  t.tm_mon  = u.month - 1;
+  t.tm_mday = u.day;
+  t.tm_hour = u.hour;
+  t.tm_min  = u.minute;
+  t.tm_sec  = u.second;
+  return timegm(&t);
+}
+}
+
+auto const date_times = [](){
+  std::uniform_int_distribution<year_t>   year_dist(1600, 2399);
+  std::uniform_int_distribution<month_t>  month_dist(1, 12);
+  std::uniform_int_distribution<day_t>    day_dist(1, 28);
+  std::uniform_int_distribution<uint32_t> seconds_dist(0, 86399);
+  std::mt19937 rng;
+  std::array<date_time_t, 16384> date_times;
+  for (auto& u : date_times) {
+    auto const s = seconds_dist(rng);
+    u = {year_dist(rng), month_dist(rng), day_dist(rng), uint8_t(s / 3600),
+      uint8_t(s % 3600 / 60), uint8_t(s % 60)};
+  }
+  return date_times;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const& u : date_times)
+        benchmark::DoNotOptimize(u);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (auto const& u : date_times) { \
+        auto const s = namespace::to_seconds(u); \
+        benchmark::DoNotOptimize(s); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+#define DO_BATCH_BENCHMARK(label, namespace) \
+  void label(benchmark::State& state) { \
+    std::array<seconds_t, 16384> seconds; \
+    for (auto _ : state) { \
+      namespace::to_seconds(date_times.data(), date_times.size(), seconds.data()); \
+      benchmark::DoNotOptimize(seconds); \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(GLibC, glibc);
+DO_BENCHMARK(NeriSchneider, neri_schneider);
+DO_BATCH_BENCHMARK(NeriSchneider_Batch, neri_schneider);
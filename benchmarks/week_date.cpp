@@ -0,0 +1,264 @@
+/*
+ week_date benchmarks
+
+ Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+
+ This file is part of https://github.com/cassioneri/calendar.
+
+ This file is free software: you can redistribute it and/or modify it under
+ the terms of the GNU General Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at your option) any later
+ version.
+
+ This file is distributed in the hope that it will be useful, but WITHOUT ANY
+ WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+ See <https://www.gnu.org/licenses/>.
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+using year_t     = int32_t;
+using month_t    = uint8_t;
+using day_t      = uint8_t;
+using rata_die_t = int32_t;
+
+struct date_t {
+  year_t  year;
+  month_t month;
+  day_t   day;
+};
+
+struct ordinal_date_t {
+  year_t   year;
+  uint16_t day;
+};
+
+// Weekdays are encoded as in std::chrono::weekday::iso_encoding (1 = Monday, ..., 7 = Sunday).
+struct iso_week_date_t {
+  year_t  year;
+  uint8_t week;
+  uint8_t weekday;
+};
+
+// Rata dies are counted from 1970-Jan-01 (a Thursday).
+
+bool is_leap_year(year_t y) {
+  return (y & (y % 100 == 0 ? 15 : 3)) == 0;
+}
+
+// Calendar date obtained by to_date followed by a table look up.
+namespace naive {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+date_t to_date(rata_die_t r) {
+
+  auto constexpr z2    = uint32_t(-1468000);
+  auto constexpr r2_e3 = uint32_t(536895458);
+
+  auto const r0 = r + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto constexpr p16 = uint32_t(1) << 16;
+  auto const n3 = 2141 * r2 + 197913;
+  auto const q3 = n3 / p16;
+  auto const r3 = n3 % p16 / 2141;
+
+  auto const y0 = 100 * q1 + q2;
+  auto const m0 = q3;
+  auto const d0 = r3;
+
+  auto const j  = r2 >= 306;
+  auto const y1 = y0 + j;
+  auto const m1 = j ? m0 - 12 : m0;
+  auto const d1 = d0 + 1;
+
+  return {year_t(y1 + z2), month_t(m1), day_t(d1)};
+}
+
+uint16_t constexpr days_before[] = { 0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+ordinal_date_t to_ordinal_date(rata_die_t n) {
+  auto const u = to_date(n);
+  return {u.year, uint16_t(days_before[u.month] + u.day + (u.month > 2 && is_leap_year(u.year)))};
+}
+
+// The ISO year and week are those of the Thursday in the same week.
+iso_week_date_t to_iso_week_date(rata_die_t n) {
+  auto const r = (n + 3) % 7;
+  auto const w = uint8_t(r < 0 ? r + 8 : r + 1);
+  auto const t = to_ordinal_date(n + 4 - w);
+  return {t.year, uint8_t((t.day + 6) / 7), w};
+}
+
+rata_die_t from_iso_week_date(iso_week_date_t const& u) {
+  // Days from 1970-Jan-01 to January 4th of u.year.
+  auto const y = u.year - 1;
+  auto const q = y / 100 - (y % 100 < 0);
+  auto const n = 365 * (y - 1969) + (y / 4 - (y % 4 < 0)) - q + (q / 4 - (q % 4 < 0)) - 477 + 3;
+  auto const r = (n + 3) % 7;
+  auto const w = r < 0 ? r + 7 : r; // 0 = Monday
+  return n - w + 7 * (u.week - 1) + u.weekday - 1;
+}
+}
+
+namespace std_chrono {
+
+ordinal_date_t to_ordinal_date(rata_die_t n) {
+  using namespace std::chrono;
+  auto const d = sys_days(days(n));
+  auto const y = year_month_day(d).year();
+  return {int(y), uint16_t((d - sys_days(y / January / 1)).count() + 1)};
+}
+
+iso_week_date_t to_iso_week_date(rata_die_t n) {
+  using namespace std::chrono;
+  auto const d = sys_days(days(n));
+  auto const w = weekday(d).iso_encoding();
+  auto const t = d + days(4 - int(w));
+  auto const y = year_month_day(t).year();
+  return {int(y), uint8_t((t - sys_days(y / January / 1)).count() / 7 + 1), uint8_t(w)};
+}
+
+rata_die_t from_iso_week_date(iso_week_date_t const& u) {
+  using namespace std::chrono;
+  auto const jan_4th = sys_days(year(u.year) / January / 4);
+  auto const monday  = jan_4th - (weekday(jan_4th) - Monday);
+  return (monday + days(7 * (u.week - 1) + u.weekday - 1)).time_since_epoch().count();
+}
+}
+
+namespace neri_schneider {
+
+// https://github.com/cassioneri/calendar/blob/master/calendar.hpp
+
+auto constexpr z2    = uint32_t(-1468000);
+auto constexpr r2_e3 = uint32_t(536895458);
+
+ordinal_date_t to_ordinal_date(rata_die_t r) {
+
+  auto const r0 = r + r2_e3;
+
+  auto const n1 = 4 * r0 + 3;
+  auto const q1 = n1 / 146097;
+  auto const r1 = n1 % 146097 / 4;
+
+  auto constexpr p32 = uint64_t(1) << 32;
+  auto const n2 = 4 * r1 + 3;
+  auto const u2 = uint64_t(2939745) * n2;
+  auto const q2 = uint32_t(u2 / p32);
+  auto const r2 = uint32_t(u2 % p32) / 2939745 / 4;
+
+  auto const y0 = 100 * q1 + q2;
+  auto const l0 = (q2 % 4 == 0) & ((q2 != 0) | (q1 % 4 == 0));
+
+  auto const j  = r2 >= 306;
+  auto const y1 = y0 + j;
+  auto const d1 = j ? r2 - 305 : r2 + 60 + l0;
+
+  return {year_t(y1 + z2), uint16_t(d1)};
+}
+
+uint8_t iso_day_of_week(uint32_t r0) {
+  auto const n = r0 + 3;
+  auto const u = uint32_t(613566757 * n);
+  auto const w = uint8_t(uint64_t(7) * u >> 32);
+  return w == 0 ? 7 : w;
+}
+
+iso_week_date_t to_iso_week_date(rata_die_t r) {
+
+  auto const u1 = to_ordinal_date(r);
+  auto const w1 = iso_day_of_week(r + r2_e3);
+
+  auto       y1 = u1.year;
+  auto       d1 = int32_t(u1.day) + 4 - int32_t(w1);
+
+  if (d1 < 1) {
+    --y1;
+    d1 += 365 + is_leap_year(y1);
+  }
+  else if (d1 > 365 && d1 > 365 + is_leap_year(y1)) {
+    d1 -= 365 + is_leap_year(y1);
+    ++y1;
+  }
+
+  return {y1, uint8_t((73 * uint32_t(d1) + 491) / 512), w1};
+}
+
+rata_die_t from_iso_week_date(iso_week_date_t const& u) {
+
+  auto const y1 = uint32_t(u.year) - z2;
+  auto const q1 = y1 / 100;
+  auto const yc = 365 * y1 + y1 / 4 - q1 + q1 / 4;
+  auto const l1 = (y1 % 4 == 0) & ((y1 != 100 * q1) | (q1 % 4 == 0));
+  auto const r4 = yc + 4 - 60 - l1;
+  auto const w4 = iso_day_of_week(r4);
+
+  return rata_die_t(r4 - w4 + 7 * u.week + u.weekday - 7 - r2_e3);
+}
+}
+
+auto const rata_dies = [](){
+  std::uniform_int_distribution<rata_die_t> uniform_dist(-146097, 146096);
+  std::mt19937 rng;
+  std::array<rata_die_t, 16384> rata_dies;
+  for (auto& n : rata_dies)
+    n = uniform_dist(rng);
+  return rata_dies;
+}();
+
+auto const week_dates = [](){
+  std::array<iso_week_date_t, 16384> week_dates;
+  for (size_t i = 0; i < rata_dies.size(); ++i)
+    week_dates[i] = neri_schneider::to_iso_week_date(rata_dies[i]);
+  return week_dates;
+}();
+
+#ifndef BENCHMARK
+  // Not on quick-bench
+  #include <benchmark/benchmark.h>
+  void Scan(benchmark::State& state) {
+    for (auto _ : state)
+      for (auto const n : rata_dies)
+        benchmark::DoNotOptimize(n);
+  }
+  BENCHMARK(Scan);
+#endif
+
+#define DO_BENCHMARK(label, namespace, function, inputs) \
+  void label(benchmark::State& state) { \
+    for (auto _ : state) { \
+      for (auto const& x : inputs) { \
+        auto const u = namespace::function(x); \
+        benchmark::DoNotOptimize(u); \
+      } \
+    } \
+  } \
+  BENCHMARK(label)
+
+DO_BENCHMARK(ToOrdinalDate_Naive, naive, to_ordinal_date, rata_dies);
+DO_BENCHMARK(ToOrdinalDate_StdChrono, std_chrono, to_ordinal_date, rata_dies);
+DO_BENCHMARK(ToOrdinalDate_NeriSchneider, neri_schneider, to_ordinal_date, rata_dies);
+
+DO_BENCHMARK(ToIsoWeekDate_Naive, naive, to_iso_week_date, rata_dies);
+DO_BENCHMARK(ToIsoWeekDate_StdChrono, std_chrono, to_iso_week_date, rata_dies);
+DO_BENCHMARK(ToIsoWeekDate_NeriSchneider, neri_schneider, to_iso_week_date, rata_dies);
+
+DO_BENCHMARK(FromIsoWeekDate_Naive, naive, from_iso_week_date, week_dates);
+DO_BENCHMARK(FromIsoWeekDate_StdChrono, std_chrono, from_iso_week_date, week_dates);
+DO_BENCHMARK(FromIsoWeekDate_NeriSchneider, neri_schneider, from_iso_week_date, week_dates);
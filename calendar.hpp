@@ -23,11 +23,24 @@
  * @brief Calendar algorithms.
  */
 
+#pragma once
+
 #include <algorithm>
+#include <array>
+#include <charconv>
+#include <compare>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <ostream>
+#include <ranges>
+#include <span>
+#include <system_error>
 #include <type_traits>
+#include <vector>
+
+#include "simd.hpp"
 
 /**
  * @brief   Month storage type.
@@ -39,6 +52,42 @@ using month_t = std::uint8_t;
  */
 using day_t = std::uint8_t;
 
+/**
+ * @brief   Day of the week storage type (0 = Sunday, 1 = Monday, ..., 6 = Saturday, as in
+ *          std::chrono::weekday::c_encoding).
+ */
+using weekday_t = std::uint8_t;
+
+/**
+ * @brief   Day of the year storage type (1 = January 1st, ..., 366 = December 31st of leap years).
+ */
+using day_of_year_t = std::uint16_t;
+
+/**
+ * @brief   ISO 8601 week of the year storage type (1, ..., 53).
+ */
+using week_t = std::uint8_t;
+
+/**
+ * @brief   Hour storage type.
+ */
+using hour_t = std::uint8_t;
+
+/**
+ * @brief   Minute storage type.
+ */
+using minute_t = std::uint8_t;
+
+/**
+ * @brief   Second storage type.
+ */
+using second_t = std::uint8_t;
+
+/**
+ * @brief   Storage type for counts of seconds (e.g., Unix time).
+ */
+using seconds_t = std::int64_t;
+
 /**
  * @brief   Date storage type.
  *
@@ -120,405 +169,3422 @@ operator <<(std::ostream& os, date_t<Y> const& u) {
 }
 
 /**
- * @brief Maximum value of a given type.
+ * @brief   Columnar (structure of arrays) storage of dates.
  *
- * @tparam T          The given type.
- */
-template <typename T>
-auto constexpr max = std::numeric_limits<T>::max();
-
-template <typename Y>
-auto constexpr max<date_t<Y>> = date_t<Y>{max<Y>, 12, 31};
-
-/**
- * @brief Minimum value of a given type.
+ * Years, months and days are stored in separate, contiguous and unpadded arrays which batch
+ * algorithms consume directly. Element-wise access goes through reference, a proxy which reads
+ * and writes date_t<Y> values.
  *
- * @tparam T          The given type.
+ * @tparam  Y         Year storage type.
  */
-template <typename T>
-auto constexpr min = std::numeric_limits<T>::min();
-
 template <typename Y>
-auto constexpr min<date_t<Y>> = date_t<Y>{min<Y>,  1,  1};
-
-/**
- * @brief   Checks whether a given number is multiple of 100 or not using the mcomp algorithm [1].
- *
- * This a special implementation, supposedly faster than built-in operator %, for a subrange of
- * std::int32_t values containing [-32767, 32767].
- *
- * [1] https://accu.org/var/uploads/journals/Overload155.pdf#page=16
- *
- * @param   n         The given number.
- * @pre               -536870800 <= n && n <= 536870999
- */
-bool constexpr
-is_multiple_of_100(std::int32_t n) noexcept {
-  // From qmodular: ./div mcomp 100
-  std::uint32_t constexpr multiplier   = 42949673;
-  std::uint32_t constexpr bound        = 42949669;
-  std::uint32_t constexpr max_dividend = 1073741799;
-
-  std::uint32_t constexpr offset       = max_dividend / 2 / 100 * 100; //  536870800
-//std::int32_t  constexpr min          = -offset;                      // -536870800
-//std::int32_t  constexpr max          = max_dividend - offset;        //  536870999
-
-  return multiplier * (n + offset) < bound;
-}
+struct date_columns_t {
 
-/**
- * @brief   Checks if a given number is multiple of 100 or not using built-in operator %.
- *
- * @tparam  T         The type of the given number.
- * @param   n         The given number.
- */
-template <typename T>
-bool constexpr
-is_multiple_of_100(T n) noexcept {
-  return n % 100 == 0;
-}
+  /**
+   * @brief Proxy to the i-th date.
+   */
+  struct reference {
 
-/**
- * @brief   Checks whether a given year is leap or not.
- *
- * @tparam  Y         Type of the given year.
- * @param   y         The given year.
- *
- * @pre               -536870800 <= y && y <= 536870999
- */
-template <typename T>
-bool constexpr
-is_leap_year(T y) noexcept {
-  // Originally, the ternary expression was similar to
-  //   is_multiple_of_100(y) ? y % 16 == 0 : y % 4 == 0;
-  // and Ulrich Drepper suggested the following twist.
-  return (y & (is_multiple_of_100(y) ? 15 : 3)) == 0;
-}
+    Y&       year;
+    month_t& month;
+    day_t&   day;
 
-/**
- * @brief   Returns the last day of the month for a given year and month.
- *
- * @tparam  Y         Type of the given year.
- * @param   y         The given year.
- * @param   m         The given month.
- */
-template <typename Y>
-month_t constexpr
-last_day_of_month(Y y, month_t m) noexcept {
-  // Originally the 2nd operand of the 1st ternary operator was
-  //   (month ^ (month >> 3)) & 1 | 30
-  // and Dr. Matthias Kretz realised '& 1' was unnecessary.
-  return m != 2 ? ((m ^ (m >> 3))) | 30 : is_leap_year(y) ? 29 : 28;
-}
+    /**
+     * @brief Returns the referred date.
+     */
+    constexpr
+    operator date_t<Y>() const noexcept {
+      return {year, month, day};
+    }
 
-/**
- * @brief   Gregorian calendar on unsigned integer types.
- *
- * @tparam  Y         Year storage type.
- * @tparam  R         Ratadie storage type
- * @pre               std::is_unsigned_v<Y> && std::is_unsigned_v<R> &&  sizeof(R) >= sizeof(Y) &&
- *                    std::numeric_limits<R>::max() >= 146097
- */
-template <typename Y = std::uint32_t, typename R = Y>
-struct ugregorian_t {
+    /**
+     * @brief Overwrites the referred date with a given one.
+     *
+     * @param u       The given date.
+     */
+    reference constexpr const&
+    operator =(date_t<Y> const& u) const noexcept {
+      year  = u.year;
+      month = u.month;
+      day   = u.day;
+      return *this;
+    }
 
-  static_assert(std::is_unsigned_v<Y> && std::is_unsigned_v<R> &&  sizeof(R) >= sizeof(Y) &&
-    std::numeric_limits<R>::max() >= 146097);
+    /**
+     * @brief Overwrites the referred date with the one referred by another proxy.
+     *
+     * @param r       The other proxy.
+     */
+    reference constexpr const&
+    operator =(reference const& r) const noexcept {
+      return *this = date_t<Y>(r);
+    }
+  }; // struct reference
 
   /**
-   * @brief Year storage type.
+   * @brief Creates empty columns.
    */
-  using year_t = Y;
+  date_columns_t() = default;
 
   /**
-   * @brief Rata die storage type.
+   * @brief Creates columns of a given size filled with zeros.
+   *
+   * @param size      The given size.
    */
-  using rata_die_t = R;
+  explicit
+  date_columns_t(std::size_t size) : years(size), months(size), days(size) {
+  }
 
   /**
-   * @brief Date storage type.
+   * @brief Returns the number of dates.
    */
-  using date_t = ::date_t<year_t>;
+  std::size_t
+  size() const noexcept {
+    return years.size();
+  }
 
   /**
-   * @brief Date used as epoch.
+   * @brief Changes the number of dates.
+   *
+   * @param size      The new size.
    */
-  static date_t constexpr epoch = date_t{0, 3, 1};
+  void
+  resize(std::size_t size) {
+    years .resize(size);
+    months.resize(size);
+    days  .resize(size);
+  }
 
   /**
-   * @brief Returns the rata die corresponding to a given date.
+   * @brief Appends a given date.
    *
-   * @param u1        The given date.
-   * @pre             date_min <= u && u <= date_max
+   * @param u         The given date.
    */
-  rata_die_t static constexpr
-  to_rata_die(date_t const& u1) noexcept {
-
-    auto const y1 = rata_die_t(u1.year);
-    auto const m1 = rata_die_t(u1.month);
-    auto const d1 = rata_die_t(u1.day);
-
-    auto const j  = rata_die_t(m1 < 3);
-    auto const y0 = y1 - j;
-    auto const m0 = j ? m1 + 12 : m1;
-    auto const d0 = d1 - 1;
-
-    auto const q1 = y0 / 100;
-    auto const yc = 1461 * y0 / 4 - q1 + q1 / 4;
-    auto const mc = (979 * m0 - 2919) / 32;
-    auto const dc = d0;
-
-    auto const r1 = yc + mc + dc;
-
-    return r1;
+  void
+  push_back(date_t<Y> const& u) {
+    years .push_back(u.year );
+    months.push_back(u.month);
+    days  .push_back(u.day  );
   }
 
   /**
-   * @brief Returns the date corresponding to a given rata die.
+   * @brief Returns a proxy to the i-th date.
    *
-   * @param r0        The given rata_die.
-   * @pre             rata_die_min <= r0 && r0 <= rata_die_max
+   * @param i         The given index.
+   * @pre             i < size()
    */
-  date_t static constexpr
-  to_date(rata_die_t r0) noexcept {
-
-    auto const     n1  = 4 * r0 + 3;
-    auto const     q1  = n1 / 146097;
-    auto const     r1  = n1 % 146097 / 4;
-
-    auto constexpr p32 = std::uint64_t(1) << 32;
-    auto const     n2  = 4 * r1 + 3;
-    auto const     u2  = std::uint64_t(2939745) * n2;
-    auto const     q2  = std::uint32_t(u2 / p32);
-    auto const     r2  = std::uint32_t(u2 % p32) / 2939745 / 4;
-
-    auto constexpr p16 = std::uint32_t(1) << 16;
-    auto const     n3  = 2141 * r2 + 197913;
-    auto const     q3  = n3 / p16;
-    auto const     r3  = n3 % p16 / 2141;
-
-    auto const     y0  = 100 * q1 + q2;
-    auto const     m0  = q3;
-    auto const     d0  = r3;
-
-    auto const     j   = r2 >= 306;
-    auto const     y1  = y0 + j;
-    auto const     m1  = j ? m0 - 12 : m0;
-    auto const     d1  = d0 + 1;
-
-    return { year_t(y1), month_t(m1), day_t(d1) };
+  reference
+  operator [](std::size_t i) noexcept {
+    return {years[i], months[i], days[i]};
   }
 
- /**
-  * @brief  Minimum date allowed as input to to_rata_die.
-  */
-  date_t static constexpr date_min = epoch;
-
   /**
-  * @brief  Maximum date allowed as input to to_rata_die.
-  */
-  date_t static constexpr date_max = []{
+   * @brief Returns the i-th date.
+   *
+   * @param i         The given index.
+   * @pre             i < size()
+   */
+  date_t<Y>
+  operator [](std::size_t i) const noexcept {
+    return {years[i], months[i], days[i]};
+  }
 
-    auto constexpr y = max<rata_die_t> / 1461;
-    if (max<year_t> <= y)
-      return max<date_t>;
+  std::vector<Y>       years;
+  std::vector<month_t> months;
+  std::vector<day_t>   days;
 
-    return date_t{year_t(y + 1), month_t(2), day_t(28 + is_leap_year(y + 1))};
-  }();
+}; // struct date_columns_t
 
-  /**
-   * @brief Minimum rata die allowed as input to to_date.
-   */
-  rata_die_t static constexpr rata_die_min = 0;
+/**
+ * @brief   Date packed into an unsigned integer whose natural order is the order of dates.
+ *
+ * Bits 0 to 4 hold the day, bits 5 to 8 hold the month and upper bits hold the year. Signed years
+ * are biased so that negative years precede non negative ones. Hence, comparisons are single
+ * integer comparisons.
+ *
+ * @tparam  Y         Year storage type.
+ * @pre               For 64-bit long years, -2^54 <= year && year < 2^54 if Y is signed and
+ *                    year < 2^55 otherwise.
+ */
+template <typename Y>
+struct packed_date_t {
 
   /**
-   * @brief Maximum rata die allowed as input to to_date.
+   * @brief Storage type (32-bit long for years up to 16-bit long and 64-bit long otherwise).
    */
-  rata_die_t static constexpr rata_die_max = []{
-    // Promoted algorithms are used to calculate rata_die_max and date_max. By promoting the year
-    // storage type to rata_die_t, they mitigate the risk of having intermediate year results that
-    // are not representable by year_t. This allows comparisons against max<year_t> to be safely
-    // performed on rata_die_max objects.
-    using pugregorian_t = ugregorian_t<rata_die_t, rata_die_t>;
-    using pyear_t       = typename pugregorian_t::year_t;
-    using pdate_t       = typename pugregorian_t::date_t;
-    auto constexpr n = (max<rata_die_t> - 3) / 4;
-    auto constexpr u = pugregorian_t::to_date(n);
-    auto constexpr v = pdate_t{ pyear_t(max<date_t>.year), max<date_t>.month, max<date_t>.day};
-    if (u <= v)
-      return n;
-    return pugregorian_t::to_rata_die(v);
-  }();
+  using storage_t = std::conditional_t<sizeof(Y) <= 2, std::uint32_t, std::uint64_t>;
 
   /**
-   * @brief Minimum rata die allowed as input to to_date for round trip.
+   * @brief Creates an uninitialised packed date.
    */
-  rata_die_t static constexpr round_rata_die_min = std::max(rata_die_min, to_rata_die(date_min));
+  packed_date_t() = default;
 
   /**
-   * @brief Maximum rata die allowed as input to to_date for round trip.
+   * @brief Packs a given date.
+   *
+   * @param u         The given date.
    */
-  rata_die_t static constexpr round_rata_die_max = std::min(rata_die_max, to_rata_die(date_max));
+  explicit constexpr
+  packed_date_t(date_t<Y> const& u) noexcept :
+    value(storage_t(uyear_t(uyear_t(u.year) + bias)) << 9 | storage_t(u.month) << 5 | u.day) {
+  }
 
   /**
-   * @brief Minimum date allowed as input to to_rata_die for round trip.
+   * @brief Returns the unpacked date.
    */
-  date_t static constexpr round_date_min = to_date(round_rata_die_min);
+  date_t<Y> constexpr
+  unpack() const noexcept {
+    return {Y(uyear_t(uyear_t(value >> 9) - bias)), month_t(value >> 5 & 15), day_t(value & 31)};
+  }
 
-  /**
-   * @brief Maximum date allowed as input to to_rata_die for round trip.
-   */
-  date_t static constexpr round_date_max = to_date(round_rata_die_max);
+  storage_t value;
 
-}; // struct ugregorian_t
+private:
+
+  using uyear_t = std::make_unsigned_t<Y>;
+
+  auto static constexpr year_bits = std::min(8 * sizeof(Y), 8 * sizeof(storage_t) - 9);
+
+  uyear_t static constexpr bias = std::is_signed_v<Y> ? uyear_t(uyear_t(1) << (year_bits - 1)) : 0;
+
+}; // struct packed_date_t
 
 /**
- * @brief   The Unix epoch, i.e., 1970-Jan-01.
+ * @brief Packed date comparison (operator ==).
  *
- * @tparam  Y         Type of year data member.
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS date to be compared.
+ * @param   v         RHS date to be compared.
  */
-template <typename Y = std::int32_t>
-auto constexpr unix_epoch = date_t<Y>{1970, 1, 1};
+template <typename Y>
+bool constexpr
+operator ==(packed_date_t<Y> const& u, packed_date_t<Y> const& v) noexcept {
+  return u.value == v.value;
+}
 
 /**
- * @brief   Gregorian calendar on signed integer types.
+ * @brief Packed date comparison (operator !=).
  *
- * This class is more configurable than ugregorian_t allowing negative years and rata dies. It also
- * allows different epochs (by default, unix_epoch). This is a thin but not free layer class around
- * ugregorian_t. Indeed, each function in gregorian_t simply adapts inputs and outputs (generally
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS date to be compared.
+ * @param   v         RHS date to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator !=(packed_date_t<Y> const& u, packed_date_t<Y> const& v) noexcept {
+  return u.value != v.value;
+}
+
+/**
+ * @brief Order for packed dates (operator <).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS date to be compared.
+ * @param   v         RHS date to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator <(packed_date_t<Y> const& u, packed_date_t<Y> const& v) noexcept {
+  return u.value < v.value;
+}
+
+/**
+ * @brief Order for packed dates (operator <=).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS date to be compared.
+ * @param   v         RHS date to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator <=(packed_date_t<Y> const& u, packed_date_t<Y> const& v) noexcept {
+  return u.value <= v.value;
+}
+
+/**
+ * @brief Stream operator for packed dates (operator <<).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         The date to be streamed out.
+ */
+template <typename Y>
+std::ostream&
+operator <<(std::ostream& os, packed_date_t<Y> const& u) {
+  return os << u.unpack();
+}
+
+/**
+ * @brief   Time of day storage type.
+ */
+struct time_of_day_t {
+  hour_t   hour;
+  minute_t minute;
+  second_t second;
+};
+
+/**
+ * @brief Time of day comparison (operator ==).
+ *
+ * @param   u         LHS time of day to be compared.
+ * @param   v         RHS time of day to be compared.
+ */
+inline bool constexpr
+operator ==(time_of_day_t const& u, time_of_day_t const& v) noexcept {
+  return u.hour == v.hour && u.minute == v.minute && u.second == v.second;
+}
+
+/**
+ * @brief Time of day comparison (operator !=).
+ *
+ * @param   u         LHS time of day to be compared.
+ * @param   v         RHS time of day to be compared.
+ */
+inline bool constexpr
+operator !=(time_of_day_t const& u, time_of_day_t const& v) noexcept {
+  return !(u == v);
+}
+
+/**
+ * @brief Stream operator for times of day (operator <<).
+ *
+ * @param   u         The time of day to be streamed out.
+ */
+inline std::ostream&
+operator <<(std::ostream& os, time_of_day_t const& u) {
+  return os << std::uint32_t(u.hour) << ':' << std::uint32_t(u.minute) << ':' <<
+    std::uint32_t(u.second);
+}
+
+/**
+ * @brief   Date and time storage type.
+ *
+ * @tparam  Y         Year storage type.
+ */
+template <typename Y>
+struct date_time_t {
+  date_t<Y>     date;
+  time_of_day_t time;
+};
+
+/**
+ * @brief Date and time comparison (operator ==).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS date and time to be compared.
+ * @param   v         RHS date and time to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator ==(date_time_t<Y> const& u, date_time_t<Y> const& v) noexcept {
+  return u.date == v.date && u.time == v.time;
+}
+
+/**
+ * @brief Date and time comparison (operator !=).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS date and time to be compared.
+ * @param   v         RHS date and time to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator !=(date_time_t<Y> const& u, date_time_t<Y> const& v) noexcept {
+  return !(u == v);
+}
+
+/**
+ * @brief Stream operator for dates and times (operator <<).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         The date and time to be streamed out.
+ */
+template <typename Y>
+std::ostream&
+operator <<(std::ostream& os, date_time_t<Y> const& u) {
+  return os << u.date << ' ' << u.time;
+}
+
+/**
+ * @brief   Date, time and fraction of second storage type.
+ *
+ * The fraction is the number of ticks (e.g., milliseconds, microseconds or nanoseconds) elapsed
+ * since the start of the second.
+ *
+ * @tparam  Y         Year storage type.
+ */
+template <typename Y>
+struct precise_date_time_t {
+  date_t<Y>     date;
+  time_of_day_t time;
+  std::uint32_t fraction;
+};
+
+/**
+ * @brief Precise date and time comparison (operator ==).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS precise date and time to be compared.
+ * @param   v         RHS precise date and time to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator ==(precise_date_time_t<Y> const& u, precise_date_time_t<Y> const& v) noexcept {
+  return u.date == v.date && u.time == v.time && u.fraction == v.fraction;
+}
+
+/**
+ * @brief Precise date and time comparison (operator !=).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS precise date and time to be compared.
+ * @param   v         RHS precise date and time to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator !=(precise_date_time_t<Y> const& u, precise_date_time_t<Y> const& v) noexcept {
+  return !(u == v);
+}
+
+/**
+ * @brief Stream operator for precise dates and times (operator <<).
+ *
+ * The fraction is streamed out as an integer number of ticks (i.e., without padding).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         The precise date and time to be streamed out.
+ */
+template <typename Y>
+std::ostream&
+operator <<(std::ostream& os, precise_date_time_t<Y> const& u) {
+  return os << u.date << ' ' << u.time << '+' << u.fraction;
+}
+
+/**
+ * @brief   Ordinal date (year and day of the year) storage type.
+ *
+ * @tparam  Y         Year storage type.
+ */
+template <typename Y>
+struct ordinal_date_t {
+  Y             year;
+  day_of_year_t day;
+};
+
+/**
+ * @brief Ordinal date comparison (operator ==).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS ordinal date to be compared.
+ * @param   v         RHS ordinal date to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator ==(ordinal_date_t<Y> const& u, ordinal_date_t<Y> const& v) noexcept {
+  return u.year == v.year && u.day == v.day;
+}
+
+/**
+ * @brief Ordinal date comparison (operator !=).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS ordinal date to be compared.
+ * @param   v         RHS ordinal date to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator !=(ordinal_date_t<Y> const& u, ordinal_date_t<Y> const& v) noexcept {
+  return !(u == v);
+}
+
+/**
+ * @brief Stream operator for ordinal dates (operator <<).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         The ordinal date to be streamed out.
+ */
+template <typename Y>
+std::ostream&
+operator <<(std::ostream& os, ordinal_date_t<Y> const& u) {
+  return os << u.year << '-' << std::uint32_t(u.day);
+}
+
+/**
+ * @brief   ISO 8601 week date storage type.
+ *
+ * Weeks start on Monday and week 1 is the one containing the first Thursday of the ISO year.
+ * Hence, the ISO year might differ from the calendar year in the first and last days of January
+ * and December. Contrary to weekday_t, days of the week are numbered 1 = Monday, ..., 7 = Sunday
+ * (as in std::chrono::weekday::iso_encoding).
+ *
+ * @tparam  Y         Year storage type.
+ */
+template <typename Y>
+struct iso_week_date_t {
+  Y             year;
+  week_t        week;
+  weekday_t     weekday;
+};
+
+/**
+ * @brief ISO 8601 week date comparison (operator ==).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS week date to be compared.
+ * @param   v         RHS week date to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator ==(iso_week_date_t<Y> const& u, iso_week_date_t<Y> const& v) noexcept {
+  return u.year == v.year && u.week == v.week && u.weekday == v.weekday;
+}
+
+/**
+ * @brief ISO 8601 week date comparison (operator !=).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         LHS week date to be compared.
+ * @param   v         RHS week date to be compared.
+ */
+template <typename Y>
+bool constexpr
+operator !=(iso_week_date_t<Y> const& u, iso_week_date_t<Y> const& v) noexcept {
+  return !(u == v);
+}
+
+/**
+ * @brief Stream operator for ISO 8601 week dates (operator <<).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   u         The week date to be streamed out.
+ */
+template <typename Y>
+std::ostream&
+operator <<(std::ostream& os, iso_week_date_t<Y> const& u) {
+  return os << u.year << "-W" << std::uint32_t(u.week) << '-' << std::uint32_t(u.weekday);
+}
+
+/**
+ * @brief Maximum value of a given type.
+ *
+ * @tparam T          The given type.
+ */
+template <typename T>
+auto constexpr max = std::numeric_limits<T>::max();
+
+template <typename Y>
+auto constexpr max<date_t<Y>> = date_t<Y>{max<Y>, 12, 31};
+
+/**
+ * @brief Minimum value of a given type.
+ *
+ * @tparam T          The given type.
+ */
+template <typename T>
+auto constexpr min = std::numeric_limits<T>::min();
+
+template <typename Y>
+auto constexpr min<date_t<Y>> = date_t<Y>{min<Y>,  1,  1};
+
+/**
+ * @brief   Checks whether a given number is multiple of 100 or not using the mcomp algorithm [1].
+ *
+ * This a special implementation, supposedly faster than built-in operator %, for a subrange of
+ * std::int32_t values containing [-32767, 32767].
+ *
+ * [1] https://accu.org/var/uploads/journals/Overload155.pdf#page=16
+ *
+ * @param   n         The given number.
+ * @pre               -536870800 <= n && n <= 536870999
+ */
+bool constexpr
+is_multiple_of_100(std::int32_t n) noexcept {
+  // From qmodular: ./div mcomp 100
+  std::uint32_t constexpr multiplier   = 42949673;
+  std::uint32_t constexpr bound        = 42949669;
+  std::uint32_t constexpr max_dividend = 1073741799;
+
+  std::uint32_t constexpr offset       = max_dividend / 2 / 100 * 100; //  536870800
+//std::int32_t  constexpr min          = -offset;                      // -536870800
+//std::int32_t  constexpr max          = max_dividend - offset;        //  536870999
+
+  return multiplier * (n + offset) < bound;
+}
+
+/**
+ * @brief   Checks if a given number is multiple of 100 or not using built-in operator %.
+ *
+ * @tparam  T         The type of the given number.
+ * @param   n         The given number.
+ */
+template <typename T>
+bool constexpr
+is_multiple_of_100(T n) noexcept {
+  return n % 100 == 0;
+}
+
+/**
+ * @brief   Checks whether a given year is leap or not.
+ *
+ * @tparam  Y         Type of the given year.
+ * @param   y         The given year.
+ *
+ * @pre               -536870800 <= y && y <= 536870999
+ */
+template <typename T>
+bool constexpr
+is_leap_year(T y) noexcept {
+  // Originally, the ternary expression was similar to
+  //   is_multiple_of_100(y) ? y % 16 == 0 : y % 4 == 0;
+  // and Ulrich Drepper suggested the following twist.
+  return (y & (is_multiple_of_100(y) ? 15 : 3)) == 0;
+}
+
+/**
+ * @brief   Checks whether given years are leap or not.
+ *
+ * Bit i % 64 of bits[i / 64] is set if, and only if, y[i] is leap. Bits beyond y.size() in the
+ * last word are left unchanged.
+ *
+ * @tparam  T         Type of the given years.
+ * @param   y         The given years.
+ * @param   bits      Output bitmask.
+ *
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999 &&
+ *                    bits.size() >= (y.size() + 63) / 64
+ */
+template <typename T>
+void
+is_leap_year(std::span<T const> y, std::span<std::uint64_t> bits) noexcept {
+
+  std::size_t i = 0;
+
+  if constexpr (std::is_integral_v<T> && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8))
+    i = simd::is_leap_year(y.data(), y.size(), bits.data());
+
+  for (; i < y.size(); ++i) {
+    auto const bit = std::uint64_t(1) << i % 64;
+    bits[i / 64] = is_leap_year(y[i]) ? bits[i / 64] | bit : bits[i / 64] & ~bit;
+  }
+}
+
+/**
+ * @brief   Returns the last day of the month for a given year and month.
+ *
+ * @tparam  Y         Type of the given year.
+ * @param   y         The given year.
+ * @param   m         The given month.
+ */
+template <typename Y>
+month_t constexpr
+last_day_of_month(Y y, month_t m) noexcept {
+  // Originally the 2nd operand of the 1st ternary operator was
+  //   (month ^ (month >> 3)) & 1 | 30
+  // and Dr. Matthias Kretz realised '& 1' was unnecessary.
+  return m != 2 ? ((m ^ (m >> 3))) | 30 : is_leap_year(y) ? 29 : 28;
+}
+
+/**
+ * @brief   Returns the last days of the months for given years and months.
+ *
+ * @tparam  Y         Type of the given years.
+ * @param   y         The given years.
+ * @param   m         The given months.
+ * @param   d         Output last days of months.
+ *
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999 && 1 <= m[i] && m[i] <= 12 &&
+ *                    m.size() >= y.size() && d.size() >= y.size()
+ */
+template <typename Y>
+void
+last_day_of_month(std::span<Y const> y, std::span<month_t const> m, std::span<day_t> d) noexcept {
+
+  std::size_t i = 0;
+
+  if constexpr (std::is_integral_v<Y> && (sizeof(Y) == 2 || sizeof(Y) == 4 || sizeof(Y) == 8))
+    i = simd::last_day_of_month(y.data(), m.data(), y.size(), d.data());
+
+  for (; i < y.size(); ++i)
+    d[i] = last_day_of_month(y[i], m[i]);
+}
+
+/**
+ * @brief   Returns the time of day corresponding to a given number of seconds since midnight.
+ *
+ * Divisions by 3600 and 60 are replaced by Euclidean affine functions [1]: for all n in [0, 86399],
+ * n / 3600 == 1193047 * n / 2^32 and n % 3600 == 1193047 * n % 2^32 / 1193047. Similarly, for all
+ * r in [0, 3599], r / 60 == 71582789 * r / 2^32 and r % 60 == 71582789 * r % 2^32 / 71582789.
+ *
+ * [1] https://arxiv.org/abs/2102.06959
+ *
+ * @param   n         The given number of seconds.
+ * @pre               n < 86400
+ */
+time_of_day_t constexpr
+to_time_of_day(std::uint32_t n) noexcept {
+
+  auto constexpr p32 = std::uint64_t(1) << 32;
+
+  auto const     u1  = std::uint64_t(1193047) * n;
+  auto const     h   = std::uint32_t(u1 / p32);
+  auto const     r   = std::uint32_t(u1 % p32) / 1193047;
+
+  auto const     u2  = std::uint64_t(71582789) * r;
+  auto const     m   = std::uint32_t(u2 / p32);
+  auto const     s   = std::uint32_t(u2 % p32) / 71582789;
+
+  return { hour_t(h), minute_t(m), second_t(s) };
+}
+
+/**
+ * @brief   Returns the quotient of a given number of ticks by the number of ticks per second.
+ *
+ * Let p = 2^s * d where d is odd. Then n / p == (n / 2^s) / d and the latter is given by the fast
+ * EAF [1] alpha * (n / 2^s) / 2^k, where alpha = 2^k / d rounded up. Coefficients were found with
+ * get_fast_eaf (see fast_eaf.cpp) and hold for all n < 2^64:
+ *
+ *     p   |  s |  k | alpha               | upper bound of n / 2^s
+ *   ------+----+----+---------------------+-----------------------
+ *   10^3  |  3 | 68 | 2361183241434822607 | 15534100272597517249
+ *   10^6  |  6 | 71 |  151115727451828647 |   934381971284062499
+ *   10^9  |  9 | 75 |   19342813113834067 |    94492922494140624
+ *
+ * The product is 128-bit long but only its upper half is used, i.e., it's a multiply-high.
+ *
+ * [1] https://arxiv.org/abs/2102.06959
+ *
+ * @tparam  p         Number of ticks per second.
+ * @param   n         The given number of ticks.
+ * @pre               p == 1000 || p == 1000000 || p == 1000000000
+ */
+template <std::uint32_t p>
+std::uint64_t constexpr
+ticks_to_seconds(std::uint64_t n) noexcept {
+
+  static_assert(p == 1000 || p == 1000000 || p == 1000000000);
+
+  auto constexpr s     = p == 1000 ? 3 : p == 1000000 ? 6 : 9;
+  auto constexpr k     = p == 1000 ? 68 : p == 1000000 ? 71 : 75;
+  auto constexpr alpha = p == 1000 ? 2361183241434822607u : p == 1000000 ? 151115727451828647u :
+    19342813113834067u;
+
+  return std::uint64_t(__uint128_t(n >> s) * alpha >> k);
+}
+
+/**
+ * @brief   Returns the remainder of a given 64-bit number by 7.
+ *
+ * The quotient n / 7 is given by the EAF [1] alpha * n / 2^67, where alpha = 2^67 / 7 rounded up =
+ * 2^64 + 2635249153387078803. Since 7 * alpha - 2^67 == 5 and 5 * n < 2^67, it holds for all
+ * n < 2^64. The product alpha * n is 129-bit long but alpha * n / 2^64 == n + 2635249153387078803
+ * * n / 2^64, i.e., n plus a multiply-high. (Two multiplications and no division.)
+ *
+ * [1] https://arxiv.org/abs/2102.06959
+ *
+ * @param   n         The given number.
+ */
+std::uint64_t constexpr
+remainder_by_7(std::uint64_t n) noexcept {
+  auto const q = std::uint64_t(((__uint128_t(n) * 2635249153387078803u >> 64) + n) >> 3);
+  return n - 7 * q;
+}
+
+/**
+ * @brief   Maximum number of characters written by to_chars for dates with a given year type.
+ *
+ * This is the length of a sign, all digits of the year and "-MM-DD".
+ *
+ * @tparam  Y         Year storage type.
+ */
+template <typename Y>
+std::size_t constexpr iso_8601_date_size = std::numeric_limits<Y>::digits10 + 8;
+
+/**
+ * @brief   Returns the ASCII digits of four numbers in [0, 99] packed in 16-bit lanes (SWAR).
+ *
+ * Lane i of the result holds the tens and units of lane i of x in its lower and upper bytes
+ * respectively. Lanes are split by the EAF [1] n / 10 == 103 * n / 2^10 which holds for all n in
+ * [0, 99]. Since 103 * 99 < 2^16, there are no carries across lanes and a single 64-bit
+ * multiplication processes all of them.
+ *
+ * [1] https://arxiv.org/abs/2102.06959
+ *
+ * @param   x         The given numbers.
+ * @pre               Each 16-bit lane of x is in [0, 99].
+ */
+std::uint64_t constexpr
+to_two_digits(std::uint64_t x) noexcept {
+  auto const t = (103 * x >> 10) & 0x000f000f000f000f;
+  auto const o = x - 10 * t;
+  return (t | o << 8) | 0x3030303030303030;
+}
+
+/**
+ * @brief   Writes a given date in ISO 8601 extended format (YYYY-MM-DD) to a given buffer without
+ *          bounds checking.
+ *
+ * Years in [0, 9999] are written with four digits. Other years are written with a sign ('-' for
+ * negative and '+' for positive years) followed by at least four digits, as in ISO 8601 expanded
+ * representations.
+ *
+ * The four least significant digits of the year, the month and the day are split into pairs of
+ * digits which are converted all at once by to_two_digits. Remaining digits of the year (if any)
+ * are given by the EAF [1] n / 10 == 429496730 * n / 2^32 and
+ * n % 10 == 429496730 * n % 2^32 / 429496730 which holds for all n < 1073741829. (As in
+ * neri_schneider::itoa of benchmarks/itoa.cpp.)
+ *
+ * [1] https://arxiv.org/abs/2102.06959
+ *
+ * @tparam  Y         Year storage type.
+ * @param   first     Pointer to the buffer.
+ * @param   u         The given date.
+ * @pre               [first, first + iso_8601_date_size<Y>) is a valid range
+ * @pre               1 <= u.month && u.month <= 12 && 1 <= u.day && u.day <= 31
+ * @return            Pointer one past the last written character.
+ */
+template <typename Y>
+char constexpr*
+to_chars(char* first, date_t<Y> const& u) noexcept {
+
+  using uyear_t = std::make_unsigned_t<Y>;
+
+  auto const s = std::is_signed_v<Y> && u.year < 0;
+  auto       n = s ? uyear_t(0 - uyear_t(u.year)) : uyear_t(u.year);
+
+  if (s || n > 9999) {
+
+    *first++ = s ? '-' : '+';
+
+    auto const q = n / 10000;
+    n -= 10000 * q;
+
+    char buffer[std::numeric_limits<uyear_t>::digits10 + 1] = {};
+    auto c = std::end(buffer);
+
+    for (std::uint64_t p = q; p != 0; ) {
+      if (p < 1073741829) {
+        auto constexpr p32 = std::uint64_t(1) << 32;
+        auto const     w   = std::uint64_t(429496730) * p;
+        *--c = char('0' + std::uint32_t(w % p32) / 429496730);
+        p = w / p32;
+      }
+      else {
+        *--c = char('0' + p % 10);
+        p /= 10;
+      }
+    }
+
+    first = std::copy(c, std::end(buffer), first);
+  }
+
+  // For all n in [0, 9999], n / 100 == 5243 * n / 2^19.
+  auto const h = std::uint32_t(n) * 5243 >> 19;
+  auto const l = std::uint32_t(n) - 100 * h;
+
+  auto const w = to_two_digits(std::uint64_t(h) | std::uint64_t(l) << 16 |
+    std::uint64_t(u.month) << 32 | std::uint64_t(u.day) << 48);
+
+  first[0] = char(w      );
+  first[1] = char(w >>  8);
+  first[2] = char(w >> 16);
+  first[3] = char(w >> 24);
+  first[4] = '-';
+  first[5] = char(w >> 32);
+  first[6] = char(w >> 40);
+  first[7] = '-';
+  first[8] = char(w >> 48);
+  first[9] = char(w >> 56);
+
+  return first + 10;
+}
+
+/**
+ * @brief   Writes a given date in ISO 8601 extended format (YYYY-MM-DD) to a given buffer.
+ *
+ * This is similar to std::to_chars: on success, the returned pointer is one past the last written
+ * character and the error code is value-initialized. Otherwise, the returned pointer is last, the
+ * error code is std::errc::value_too_large and the contents of [first, last) are unspecified.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   first     Pointer to the beginning of the buffer.
+ * @param   last      Pointer to the end of the buffer.
+ * @param   u         The given date.
+ * @pre               See to_chars(char*, date_t<Y> const&).
+ */
+template <typename Y>
+std::to_chars_result constexpr
+to_chars(char* first, char* last, date_t<Y> const& u) noexcept {
+
+  if (std::size_t(last - first) >= iso_8601_date_size<Y>)
+    return { to_chars(first, u), std::errc() };
+
+  char buffer[iso_8601_date_size<Y>] = {};
+  auto const end  = to_chars(buffer, u);
+  auto const size = end - buffer;
+
+  if (last - first < size)
+    return { last, std::errc::value_too_large };
+
+  return { std::copy(buffer, end, first), std::errc() };
+}
+
+/**
+ * @brief   Writes dates of a given source in ISO 8601 extended format (YYYY-MM-DD), each followed
+ *          by a given delimiter, to a contiguous buffer.
+ *
+ * Implements the to_chars overloads for std::span<date_t<Y> const> and date_columns_t<Y>.
+ *
+ * @tparam  Y         Year storage type.
+ * @tparam  U         Source type whose size() is the number of dates and whose operator[] returns
+ *                    the i-th date.
+ * @param   first     Pointer to the beginning of the buffer.
+ * @param   last      Pointer to the end of the buffer.
+ * @param   u         The given source.
+ * @param   delimiter The given delimiter.
+ * @pre               See to_chars(char*, date_t<Y> const&) for all u[i].
+ */
+template <typename Y, typename U>
+std::to_chars_result
+to_chars_dates(char* first, char* last, U const& u, char delimiter) noexcept {
+
+  auto constexpr size = iso_8601_date_size<Y> + 1;
+
+  std::size_t i = 0;
+
+  for (; i < u.size() && std::size_t(last - first) >= size; ++i) {
+    first    = to_chars(first, u[i]);
+    *first++ = delimiter;
+  }
+
+  for (; i < u.size(); ++i) {
+    auto const r = to_chars(first, last, u[i]);
+    if (r.ec != std::errc() || r.ptr == last)
+      return { last, std::errc::value_too_large };
+    first    = r.ptr;
+    *first++ = delimiter;
+  }
+
+  return { first, std::errc() };
+}
+
+/**
+ * @brief   Writes given dates in ISO 8601 extended format (YYYY-MM-DD), each followed by a given
+ *          delimiter, to a contiguous buffer.
+ *
+ * While the buffer has room for the longest date, writes are unchecked. Returned values and errors
+ * are as in to_chars(char*, char*, date_t<Y> const&).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   first     Pointer to the beginning of the buffer.
+ * @param   last      Pointer to the end of the buffer.
+ * @param   u         The given dates.
+ * @param   delimiter The given delimiter.
+ * @pre               See to_chars(char*, date_t<Y> const&) for all u[i].
+ */
+template <typename Y>
+std::to_chars_result
+to_chars(char* first, char* last, std::span<date_t<Y> const> u, char delimiter = '\n') noexcept {
+  return to_chars_dates<Y>(first, last, u, delimiter);
+}
+
+/**
+ * @brief   Writes given dates, stored in columns, in ISO 8601 extended format (YYYY-MM-DD), each
+ *          followed by a given delimiter, to a contiguous buffer.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   first     Pointer to the beginning of the buffer.
+ * @param   last      Pointer to the end of the buffer.
+ * @param   u         The given dates.
+ * @param   delimiter The given delimiter.
+ * @pre               See to_chars(char*, date_t<Y> const&) for all u[i].
+ */
+template <typename Y>
+std::to_chars_result
+to_chars(char* first, char* last, date_columns_t<Y> const& u, char delimiter = '\n') noexcept {
+  return to_chars_dates<Y>(first, last, u, delimiter);
+}
+
+/**
+ * @brief   Parses a date in ISO 8601 extended format with four digits for the year (YYYY-MM-DD)
+ *          from a given buffer without bounds checking (SWAR).
+ *
+ * The first eight characters are loaded as one 64-bit word and the last two as one 16-bit word.
+ * Characters are checked to be digits (c & 0xf0 == 0x30 and (c + 6) & 0xf0 == 0x30) or separators
+ * all at once. Then, pairs of digits are combined by 10 * a + b in all lanes at once, giving the
+ * two halves of the year and the month. Finally, the month is checked to be in [1, 12] and the day
+ * in [1, last_day_of_month(year, month)]. All checks are branchless.
+ *
+ * The output date is always written but it's meaningful only when the input is valid.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   first     Pointer to the buffer.
+ * @param   u         Output date.
+ * @pre               [first, first + 10) is a valid range
+ * @pre               std::numeric_limits<Y>::max() >= 9999
+ * @return            Whether the input is a valid date.
+ */
+template <typename Y>
+bool constexpr
+from_chars(char const* first, date_t<Y>& u) noexcept {
+
+  // Bytes 0 to 3, 5 and 6 are digits whereas bytes 4 and 7 are '-'.
+  std::uint64_t constexpr digits = 0x00ffff00ffffffff;
+  std::uint64_t constexpr zeros  = 0x3030303030303030 & digits;
+  std::uint64_t constexpr dashes = 0x2d00002d00000000;
+
+  std::uint64_t w = 0;
+  for (unsigned i = 0; i < 8; ++i)
+    w |= std::uint64_t(std::uint8_t(first[i])) << 8 * i;
+
+  auto const e = std::uint32_t(std::uint8_t(first[8])) | std::uint32_t(std::uint8_t(first[9])) << 8;
+
+  auto const ok_w = ((w & 0xf0f0f0f0f0f0f0f0 & digits) == zeros) &
+    (((w + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0 & digits) == zeros) & ((w & ~digits) == dashes);
+  auto const ok_e = ((e & 0xf0f0) == 0x3030) & (((e + 0x0606) & 0xf0f0) == 0x3030);
+
+  // Byte i of p is 10 * (byte i of v) + byte i + 1 of v. Since v's bytes are at most 15, there are
+  // no carries across bytes.
+  auto const v  = (w & digits) - zeros;
+  auto const p  = 10 * v + (v >> 8);
+  auto const y  = 100 * std::uint32_t(p & 0xff) + std::uint32_t(p >> 16 & 0xff);
+  auto const m  = std::uint32_t(p >> 40 & 0xff);
+  auto const f  = e - 0x3030;
+  auto const d  = 10 * (f & 0xff) + (f >> 8 & 0xff);
+
+  u = { Y(y), month_t(m), day_t(d) };
+
+  return ok_w & ok_e & (m - 1 < 12) & (d - 1 < last_day_of_month(y, month_t(m)));
+}
+
+/**
+ * @brief   Parses a date in ISO 8601 extended format from a given buffer.
+ *
+ * Accepts YYYY-MM-DD and the expanded representations written by to_chars, that is, a sign
+ * followed by at least four digits for the year. The former is parsed by the unchecked
+ * from_chars(char const*, date_t<Y>&) when the buffer holds at least ten characters.
+ *
+ * This is similar to std::from_chars: on success, the returned pointer is one past the last parsed
+ * character and the error code is value-initialized. Otherwise, the returned pointer is first and
+ * the error code is std::errc::invalid_argument if the input is not a valid date or
+ * std::errc::result_out_of_range if the year is not representable by Y. The output date is only
+ * modified on success.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   first     Pointer to the beginning of the buffer.
+ * @param   last      Pointer to the end of the buffer.
+ * @param   u         Output date.
+ * @pre               std::numeric_limits<Y>::max() >= 9999
+ */
+template <typename Y>
+std::from_chars_result constexpr
+from_chars(char const* first, char const* last, date_t<Y>& u) noexcept {
+
+  using uyear_t = std::make_unsigned_t<Y>;
+
+  auto const size = last - first;
+
+  if (size >= 10 && first[0] != '+' && first[0] != '-') {
+    date_t<Y> v;
+    if (!from_chars(first, v))
+      return { first, std::errc::invalid_argument };
+    u = v;
+    return { first + 10, std::errc() };
+  }
+
+  if (size < 11 || (first[0] != '+' && first[0] != '-'))
+    return { first, std::errc::invalid_argument };
+
+  auto const s = first[0] == '-';
+  auto const b = uyear_t(s ? uyear_t(0) - uyear_t(min<Y>) : uyear_t(max<Y>));
+
+  auto c     = first + 1;
+  auto n     = uyear_t(0);
+  auto large = false;
+
+  for (; c != last && '0' <= *c && *c <= '9'; ++c) {
+    auto const r = uyear_t(*c - '0');
+    large = large || r > b || n > (b - r) / 10;
+    n     = uyear_t(10 * n + r);
+  }
+
+  auto const digits = c - first - 1;
+
+  if (digits < 4 || last - c < 6 || c[0] != '-' || c[3] != '-')
+    return { first, std::errc::invalid_argument };
+
+  auto const is_digit = [](char x) { return '0' <= x && x <= '9'; };
+
+  if (!is_digit(c[1]) || !is_digit(c[2]) || !is_digit(c[4]) || !is_digit(c[5]))
+    return { first, std::errc::invalid_argument };
+
+  auto const m = std::uint32_t(10 * (c[1] - '0') + (c[2] - '0'));
+  auto const d = std::uint32_t(10 * (c[4] - '0') + (c[5] - '0'));
+
+  if (m - 1 >= 12)
+    return { first, std::errc::invalid_argument };
+
+  if (large)
+    return { first, std::errc::result_out_of_range };
+
+  // Leapness depends on the year modulo 400 only (and not on its sign).
+  if (d - 1 >= last_day_of_month(n % 400, month_t(m)))
+    return { first, std::errc::invalid_argument };
+
+  u = { Y(s ? uyear_t(0) - n : n), month_t(m), day_t(d) };
+
+  return { c + 6, std::errc() };
+}
+
+/**
+ * @brief   Writes a given time of day in ISO 8601 extended format (hh:mm:ss) to a given buffer
+ *          without bounds checking.
+ *
+ * The hour, minute and second are converted all at once by to_two_digits.
+ *
+ * @param   first     Pointer to the buffer.
+ * @param   u         The given time of day.
+ * @pre               [first, first + 8) is a valid range
+ * @pre               u.hour < 24 && u.minute < 60 && u.second < 60
+ * @return            Pointer one past the last written character.
+ */
+inline char constexpr*
+to_chars(char* first, time_of_day_t const& u) noexcept {
+
+  auto const w = to_two_digits(std::uint64_t(u.hour) | std::uint64_t(u.minute) << 16 |
+    std::uint64_t(u.second) << 32);
+
+  first[0] = char(w      );
+  first[1] = char(w >>  8);
+  first[2] = ':';
+  first[3] = char(w >> 16);
+  first[4] = char(w >> 24);
+  first[5] = ':';
+  first[6] = char(w >> 32);
+  first[7] = char(w >> 40);
+
+  return first + 8;
+}
+
+/**
+ * @brief   Parses a time of day in ISO 8601 extended format (hh:mm:ss) from a given buffer without
+ *          bounds checking (SWAR).
+ *
+ * The eight characters are loaded as one 64-bit word and checked and converted as in
+ * from_chars(char const*, date_t<Y>&). Leap seconds (ss == 60) are rejected.
+ *
+ * The output time of day is always written but it's meaningful only when the input is valid.
+ *
+ * @param   first     Pointer to the buffer.
+ * @param   u         Output time of day.
+ * @pre               [first, first + 8) is a valid range
+ * @return            Whether the input is a valid time of day.
+ */
+inline bool constexpr
+from_chars(char const* first, time_of_day_t& u) noexcept {
+
+  // Bytes 0, 1, 3, 4, 6 and 7 are digits whereas bytes 2 and 5 are ':'.
+  std::uint64_t constexpr digits = 0xffff00ffff00ffff;
+  std::uint64_t constexpr zeros  = 0x3030303030303030 & digits;
+  std::uint64_t constexpr colons = 0x00003a00003a0000;
+
+  std::uint64_t w = 0;
+  for (unsigned i = 0; i < 8; ++i)
+    w |= std::uint64_t(std::uint8_t(first[i])) << 8 * i;
+
+  auto const ok = ((w & 0xf0f0f0f0f0f0f0f0 & digits) == zeros) &
+    (((w + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0 & digits) == zeros) & ((w & ~digits) == colons);
+
+  auto const v = (w & digits) - zeros;
+  auto const p = 10 * v + (v >> 8);
+  auto const h = std::uint32_t(p       & 0xff);
+  auto const m = std::uint32_t(p >> 24 & 0xff);
+  auto const s = std::uint32_t(p >> 48 & 0xff);
+
+  u = { hour_t(h), minute_t(m), second_t(s) };
+
+  return ok & (h < 24) & (m < 60) & (s < 60);
+}
+
+/**
+ * @brief   Policy for to_date that evaluates EAFs only (default).
+ */
+struct eaf_to_date_t {
+
+  /**
+   * @brief Does not convert (callers evaluate EAFs).
+   *
+   * @tparam C        The calendar.
+   */
+  template <typename C>
+  bool static constexpr
+  to_date(typename C::rata_die_t, typename C::date_t&) noexcept {
+    return false;
+  }
+};
+
+/**
+ * @brief   Policy for to_date that looks up years in a table for dates in [first-Jan-01,
+ *          last-Dec-31] and evaluates EAFs otherwise.
+ *
+ * The table holds the rata dies of March 1st of years first - 1 to last + 1. Hence, it covers years
+ * of the computational calendar (starting on March 1st) containing dates in the window. Since these
+ * years have 365 or 366 days, for fewer than 365 years, e = (n - table[0]) / 365 is the index k of
+ * the year containing rata die n or k + 1. A comparison to table[e] gives k. Then the day of the
+ * year is r2 = n - table[k] and the month and day are given by the last step of to_date (one
+ * multiplication and one division by 2141 performed as a multiplication). Compared to to_date, this
+ * replaces two multiplications by a load from a table which, for a window of 200 years and 32-bit
+ * rata dies, takes 808 bytes.
+ *
+ * @tparam  first     First year of the window.
+ * @tparam  last      Last year of the window.
+ * @pre               first <= last && last - first < 363
+ */
+template <std::int64_t first, std::int64_t last>
+struct table_to_date_t {
+
+  static_assert(first <= last && last - first < 363);
+
+  /**
+   * @brief Rata dies of March 1st of years first - 1 to last + 1 for calendar C.
+   *
+   * @tparam C        The calendar.
+   */
+  template <typename C>
+  static constexpr auto year_starts = []{
+
+    using year_t = typename C::year_t;
+    using date_t = typename C::date_t;
+
+    static_assert(C::date_min <= date_t{year_t(first - 1), 3, 1} &&
+      date_t{year_t(last + 1), 3, 1} <= C::date_max);
+
+    std::array<typename C::rata_die_t, last - first + 3> t;
+    for (std::size_t i = 0; i < t.size(); ++i)
+      t[i] = C::to_rata_die(date_t{year_t(first - 1 + std::int64_t(i)), 3, 1});
+    return t;
+  }();
+
+  /**
+   * @brief Converts a given rata die into a date if it is in the window.
+   *
+   * @tparam C        The calendar.
+   * @param  n        The given rata die.
+   * @param  u        Output date (only written if n is in the window).
+   * @return          Whether n is in the window.
+   */
+  template <typename C>
+  bool static constexpr
+  to_date(typename C::rata_die_t n, typename C::date_t& u) noexcept {
+
+    using urata_die_t = std::make_unsigned_t<typename C::rata_die_t>;
+
+    auto const& t = year_starts<C>;
+    auto const  d = urata_die_t(urata_die_t(n) - urata_die_t(t.front()));
+
+    if (d >= urata_die_t(urata_die_t(t.back()) - urata_die_t(t.front())))
+      return false;
+
+    auto const     e   = std::uint32_t(d) / 365;
+    auto const     k   = e - (n < t[e]);
+    auto const     r2  = std::uint32_t(n - t[k]);
+
+    auto constexpr p16 = std::uint32_t(1) << 16;
+    auto const     n3  = 2141 * r2 + 197913;
+    auto const     q3  = n3 / p16;
+    auto const     r3  = n3 % p16 / 2141;
+
+    auto const     j   = r2 >= 306;
+    auto const     y1  = first - 1 + std::int64_t(k) + j;
+    auto const     m1  = j ? q3 - 12 : q3;
+    auto const     d1  = r3 + 1;
+
+    u = { typename C::year_t(y1), month_t(m1), day_t(d1) };
+    return true;
+  }
+};
+
+/**
+ * @brief   Converts the given rata dies, expected to be (nearly) sorted, into dates.
+ *
+ * The i-th date is stored in y1[i], m1[i] and d1[i]. The month of the previous rata die is kept as
+ * the range of its rata dies [first, first + length). Rata dies in this month are converted by one
+ * subtraction and those in the next month, by carrying into it. Others (e.g., after large jumps or
+ * backwards) are converted by C::to_date and start a new month. Results match C::to_date bit for
+ * bit for all inputs but only runs of rata dies in the same or consecutive months are faster than
+ * the batch to_date.
+ *
+ * @tparam  C         The calendar (ugregorian_t or gregorian_t).
+ * @param   r0        The given rata dies.
+ * @param   y1        Output years.
+ * @param   m1        Output months.
+ * @param   d1        Output days.
+ * @pre               C::rata_die_min <= r0[i] && r0[i] <= C::rata_die_max for all i
+ * @pre               r0.size() <= y1.size() && r0.size() <= m1.size() && r0.size() <= d1.size()
+ */
+template <typename C>
+void
+to_date_month_runs(std::span<typename C::rata_die_t const> r0, std::span<typename C::year_t> y1,
+  std::span<month_t> m1, std::span<day_t> d1) noexcept {
+
+  using rata_die_t = typename C::rata_die_t;
+  using year_t     = typename C::year_t;
+  using urata_t    = std::make_unsigned_t<rata_die_t>;
+
+  // The month of rata_die_max might extend beyond max<rata_die_t> (e.g., for 64-bit rata dies)
+  // and then unsigned differences wrap around. In this case, extra comparisons are required.
+  bool constexpr may_wrap = C::rata_die_max > max<rata_die_t> - 31;
+
+  auto const in = [](rata_die_t n, rata_die_t first, urata_t length) {
+    auto const d = urata_t(urata_t(n) - urata_t(first));
+    if constexpr (may_wrap)
+      return d < length && first <= n;
+    else
+      return d < length;
+  };
+
+  auto u1     = typename C::date_t{};
+  auto first  = rata_die_t(0);
+  auto length = urata_t(0);
+
+  for (std::size_t i = 0; i < r0.size(); ++i) {
+
+    auto const n = r0[i];
+
+    if (!in(n, first, length)) {
+
+      auto const next_first  = rata_die_t(urata_t(first) + length);
+      auto const carry       = u1.month == 12;
+      auto const next_year   = year_t(carry ? u1.year + 1 : u1.year);
+      auto const next_month  = month_t(carry ? 1 : u1.month + 1);
+      auto const next_length = urata_t(last_day_of_month(next_year % 400, next_month));
+
+      if (length != 0 && in(n, next_first, next_length) && (!may_wrap || first < n)) {
+        u1.year  = next_year;
+        u1.month = next_month;
+        first    = next_first;
+        length   = next_length;
+      }
+      else {
+        u1     = C::to_date(n);
+        first  = rata_die_t(n - (u1.day - 1));
+        length = urata_t(last_day_of_month(u1.year % 400, u1.month));
+      }
+    }
+
+    y1[i] = u1.year;
+    m1[i] = u1.month;
+    d1[i] = day_t(urata_t(n) - urata_t(first) + 1);
+  }
+}
+
+/**
+ * @brief   Gregorian calendar on unsigned integer types.
+ *
+ * @tparam  Y         Year storage type.
+ * @tparam  R         Ratadie storage type
+ * @tparam  P         Policy for to_date (eaf_to_date_t or table_to_date_t).
+ * @pre               std::is_unsigned_v<Y> && std::is_unsigned_v<R> &&  sizeof(R) >= sizeof(Y) &&
+ *                    std::numeric_limits<R>::max() >= 146097
+ */
+template <typename Y = std::uint32_t, typename R = Y, typename P = eaf_to_date_t>
+struct ugregorian_t {
+
+  static_assert(std::is_unsigned_v<Y> && std::is_unsigned_v<R> &&  sizeof(R) >= sizeof(Y) &&
+    std::numeric_limits<R>::max() >= 146097);
+
+  /**
+   * @brief Year storage type.
+   */
+  using year_t = Y;
+
+  /**
+   * @brief Rata die storage type.
+   */
+  using rata_die_t = R;
+
+  /**
+   * @brief Date storage type.
+   */
+  using date_t = ::date_t<year_t>;
+
+  /**
+   * @brief Columnar date storage type.
+   */
+  using date_columns_t = ::date_columns_t<year_t>;
+
+  /**
+   * @brief Packed date storage type.
+   */
+  using packed_date_t = ::packed_date_t<year_t>;
+
+  /**
+   * @brief Ordinal date storage type.
+   */
+  using ordinal_date_t = ::ordinal_date_t<year_t>;
+
+  /**
+   * @brief ISO 8601 week date storage type.
+   */
+  using iso_week_date_t = ::iso_week_date_t<year_t>;
+
+  /**
+   * @brief Policy for to_date.
+   */
+  using to_date_policy_t = P;
+
+  /**
+   * @brief Date used as epoch.
+   */
+  static date_t constexpr epoch = date_t{0, 3, 1};
+
+  /**
+   * @brief Returns the rata die corresponding to a given date.
+   *
+   * @param u1        The given date.
+   * @pre             date_min <= u && u <= date_max
+   */
+  rata_die_t static constexpr
+  to_rata_die(date_t const& u1) noexcept {
+
+    auto const y1 = rata_die_t(u1.year);
+    auto const m1 = rata_die_t(u1.month);
+    auto const d1 = rata_die_t(u1.day);
+
+    auto const j  = rata_die_t(m1 < 3);
+    auto const y0 = y1 - j;
+    auto const m0 = j ? m1 + 12 : m1;
+    auto const d0 = d1 - 1;
+
+    auto const q1 = y0 / 100;
+    // For 64-bit rata dies, 1461 * y0 might overflow whereas 365 * y0 + y0 / 4 == 1461 * y0 / 4
+    // only wraps around when the final result does and, hence, it's correct in modular arithmetics.
+    auto const yc = (sizeof(rata_die_t) == 8 ? 365 * y0 + y0 / 4 : 1461 * y0 / 4) - q1 + q1 / 4;
+    auto const mc = (979 * m0 - 2919) / 32;
+    auto const dc = d0;
+
+    auto const r1 = yc + mc + dc;
+
+    return r1;
+  }
+
+  /**
+   * @brief Returns the rata die corresponding to a given packed date.
+   *
+   * @param p1        The given packed date.
+   * @pre             date_min <= p1.unpack() && p1.unpack() <= date_max
+   */
+  rata_die_t static constexpr
+  to_rata_die(packed_date_t const& p1) noexcept {
+    return to_rata_die(p1.unpack());
+  }
+
+  /**
+   * @brief Converts the given dates into rata dies.
+   *
+   * When rata_die_t is 32-bit long and year_t is 16 or 32-bit long, SIMD kernels (if available)
+   * process the bulk of the input, deinterleaving years, months and days in registers. Remaining
+   * elements are processed by the scalar to_rata_die and the results match it bit for bit.
+   *
+   * @param u1        The given dates.
+   * @param r1        Output rata dies.
+   * @pre             date_min <= u1[i] && u1[i] <= date_max for all i
+   * @pre             u1.size() <= r1.size()
+   */
+  void static
+  to_rata_die(std::span<date_t const> u1, std::span<rata_die_t> r1) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4 && (sizeof(year_t) == 2 || sizeof(year_t) == 4))
+      i = simd::to_rata_die(u1.data(), u1.size(), 0, 0, r1.data());
+
+    for (; i < u1.size(); ++i)
+      r1[i] = to_rata_die(u1[i]);
+  }
+
+  /**
+   * @brief Converts the given dates into rata dies.
+   *
+   * The i-th date is (y1[i], m1[i], d1[i]). When rata_die_t is 32-bit long and year_t is 16 or
+   * 32-bit long, SIMD kernels (if available) process the bulk of the input. Remaining elements are
+   * processed by the scalar to_rata_die and the results match it bit for bit.
+   *
+   * @param y1        The given years.
+   * @param m1        The given months.
+   * @param d1        The given days.
+   * @param r1        Output rata dies.
+   * @pre             date_min <= (y1[i], m1[i], d1[i]) && (y1[i], m1[i], d1[i]) <= date_max for
+   *                  all i
+   * @pre             y1.size() <= m1.size() && y1.size() <= d1.size() && y1.size() <= r1.size()
+   */
+  void static
+  to_rata_die(std::span<year_t const> y1, std::span<month_t const> m1, std::span<day_t const> d1,
+    std::span<rata_die_t> r1) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4 && (sizeof(year_t) == 2 || sizeof(year_t) == 4))
+      i = simd::to_rata_die(y1.data(), m1.data(), d1.data(), y1.size(), 0, 0, r1.data());
+
+    for (; i < y1.size(); ++i)
+      r1[i] = to_rata_die(date_t{y1[i], m1[i], d1[i]});
+  }
+
+  /**
+   * @brief Converts the given dates, stored in columns, into rata dies.
+   *
+   * @param u1        The given dates.
+   * @param r1        Output rata dies.
+   * @pre             date_min <= u1[i] && u1[i] <= date_max for all i
+   * @pre             u1.size() <= r1.size()
+   */
+  void static
+  to_rata_die(date_columns_t const& u1, std::span<rata_die_t> r1) noexcept {
+    to_rata_die(u1.years, u1.months, u1.days, r1);
+  }
+
+  /**
+   * @brief Parses a date in ISO 8601 extended format (see ::from_chars) and returns its rata die.
+   *
+   * Dates outside [date_min, date_max] are reported as std::errc::result_out_of_range.
+   *
+   * @param first     Pointer to the beginning of the buffer.
+   * @param last      Pointer to the end of the buffer.
+   * @param r1        Output rata die.
+   */
+  std::from_chars_result static constexpr
+  from_chars(char const* first, char const* last, rata_die_t& r1) noexcept {
+
+    date_t u1;
+    auto const r = ::from_chars(first, last, u1);
+
+    if (r.ec != std::errc())
+      return r;
+
+    if (u1 < date_min || date_max < u1)
+      return { first, std::errc::result_out_of_range };
+
+    r1 = to_rata_die(u1);
+    return r;
+  }
+
+  /**
+   * @brief Parses fixed-width dates in ISO 8601 extended format (YYYY-MM-DD) into rata dies and
+   * flags which of them are valid.
+   *
+   * The i-th date is made of the first ten characters of chars[width * i, width * (i + 1)) and
+   * the remaining ones (e.g., delimiters) are ignored. The number of dates is the number of i such
+   * that width * i + 10 <= chars.size(). Hence, the last record might be shorter than width.
+   *
+   * Bit i % 64 of valid[i / 64] is set if, and only if, the i-th date is valid and in [date_min,
+   * date_max]. Unused bits of the last word are cleared. Results for invalid inputs are unspecified
+   * but evaluating them is safe. Dates are parsed by the branchless SWAR
+   * ::from_chars(char const*, date_t&).
+   *
+   * @param chars     The given characters.
+   * @param width     The given width of records.
+   * @param r1        Output rata dies.
+   * @param valid     Output bitmap of valid inputs.
+   * @pre             width >= 10
+   * @pre             The number of dates is at most r1.size() and 64 * valid.size().
+   */
+  void static
+  from_chars(std::span<char const> chars, std::size_t width, std::span<rata_die_t> r1,
+    std::span<std::uint64_t> valid) noexcept {
+
+    auto const size = chars.size() < 10 ? 0 : (chars.size() - 10) / width + 1;
+
+    for (std::size_t i = 0; i < size; i += 64) {
+
+      auto const    end  = std::min(size, i + 64);
+      std::uint64_t word = 0;
+
+      for (std::size_t j = i; j < end; ++j) {
+        date_t     u1;
+        auto const ok = ::from_chars(chars.data() + width * j, u1) & (date_min <= u1) &
+          (u1 <= date_max);
+        r1[j] = to_rata_die(u1);
+        word |= std::uint64_t(ok) << (j - i);
+      }
+
+      valid[i / 64] = word;
+    }
+  }
+
+  /**
+   * @brief Returns the date corresponding to a given rata die.
+   *
+   * When P is table_to_date_t, rata dies in its window are converted by table look up.
+   *
+   * @param r0        The given rata_die.
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max
+   */
+  date_t static constexpr
+  to_date(rata_die_t r0) noexcept {
+
+    if constexpr (!std::is_same_v<P, eaf_to_date_t>) {
+      date_t u1;
+      if (P::template to_date<ugregorian_t>(r0, u1))
+        return u1;
+    }
+
+    auto const     n1  = 4 * r0 + 3;
+    auto const     q1  = [r0, n1]{
+      // For 64-bit rata dies, 4 * r0 + 3 might overflow. However, for all r0 < 2^64,
+      // (4 * r0 + 3) / 146097 == (4137408090565272301 * r0 + 3103056067923954226) / 2^77.
+      if constexpr (sizeof(rata_die_t) == 8)
+        return rata_die_t((__uint128_t(r0) * 4137408090565272301u + 3103056067923954226u) >> 77);
+      else
+        return n1 / 146097;
+    }();
+    auto const     r1  = (n1 - 146097 * q1) / 4;
+
+    auto constexpr p32 = std::uint64_t(1) << 32;
+    auto const     n2  = 4 * r1 + 3;
+    auto const     u2  = std::uint64_t(2939745) * n2;
+    auto const     q2  = std::uint32_t(u2 / p32);
+    auto const     r2  = std::uint32_t(u2 % p32) / 2939745 / 4;
+
+    auto constexpr p16 = std::uint32_t(1) << 16;
+    auto const     n3  = 2141 * r2 + 197913;
+    auto const     q3  = n3 / p16;
+    auto const     r3  = n3 % p16 / 2141;
+
+    auto const     y0  = 100 * q1 + q2;
+    auto const     m0  = q3;
+    auto const     d0  = r3;
+
+    auto const     j   = r2 >= 306;
+    auto const     y1  = y0 + j;
+    auto const     m1  = j ? m0 - 12 : m0;
+    auto const     d1  = d0 + 1;
+
+    return { year_t(y1), month_t(m1), day_t(d1) };
+  }
+
+  /**
+   * @brief Returns the packed date corresponding to a given rata die.
+   *
+   * @param r0        The given rata_die.
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max
+   */
+  packed_date_t static constexpr
+  to_packed_date(rata_die_t r0) noexcept {
+    return packed_date_t(to_date(r0));
+  }
+
+  /**
+   * @brief Converts the given rata dies into dates.
+   *
+   * The i-th date is stored in y1[i], m1[i] and d1[i]. When rata_die_t is 32-bit long and year_t is
+   * 16 or 32-bit long, SIMD kernels (if available) process the bulk of the input. Remaining
+   * elements are processed by the scalar to_date and the results match it bit for bit.
+   *
+   * @param r0        The given rata dies.
+   * @param y1        Output years.
+   * @param m1        Output months.
+   * @param d1        Output days.
+   * @pre             rata_die_min <= r0[i] && r0[i] <= rata_die_max for all i
+   * @pre             r0.size() <= y1.size() && r0.size() <= m1.size() && r0.size() <= d1.size()
+   */
+  void static
+  to_date(std::span<rata_die_t const> r0, std::span<year_t> y1, std::span<month_t> m1,
+    std::span<day_t> d1) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4 && (sizeof(year_t) == 2 || sizeof(year_t) == 4))
+      i = simd::to_date(r0.data(), r0.size(), 0, 0, y1.data(), m1.data(), d1.data());
+
+    for (; i < r0.size(); ++i) {
+      auto const u = to_date(r0[i]);
+      y1[i] = u.year;
+      m1[i] = u.month;
+      d1[i] = u.day;
+    }
+  }
+
+  /**
+   * @brief Converts the given rata dies into dates stored in columns.
+   *
+   * @param r0        The given rata dies.
+   * @param u1        Output dates.
+   * @pre             rata_die_min <= r0[i] && r0[i] <= rata_die_max for all i
+   * @pre             r0.size() <= u1.size()
+   */
+  void static
+  to_date(std::span<rata_die_t const> r0, date_columns_t& u1) noexcept {
+    to_date(r0, u1.years, u1.months, u1.days);
+  }
+
+  /**
+   * @brief Converts the given rata dies, expected to be (nearly) sorted, into dates.
+   *
+   * This delegates to to_date_month_runs which falls back to to_date outside runs of rata dies in
+   * the same or consecutive months.
+   *
+   * @param r0        The given rata dies.
+   * @param y1        Output years.
+   * @param m1        Output months.
+   * @param d1        Output days.
+   * @pre             rata_die_min <= r0[i] && r0[i] <= rata_die_max for all i
+   * @pre             r0.size() <= y1.size() && r0.size() <= m1.size() && r0.size() <= d1.size()
+   */
+  void static
+  to_date_sorted(std::span<rata_die_t const> r0, std::span<year_t> y1, std::span<month_t> m1,
+    std::span<day_t> d1) noexcept {
+    to_date_month_runs<ugregorian_t>(r0, y1, m1, d1);
+  }
+
+  /**
+   * @brief Converts the given rata dies, expected to be (nearly) sorted, into dates stored in
+   * columns.
+   *
+   * @param r0        The given rata dies.
+   * @param u1        Output dates.
+   * @pre             rata_die_min <= r0[i] && r0[i] <= rata_die_max for all i
+   * @pre             r0.size() <= u1.size()
+   */
+  void static
+  to_date_sorted(std::span<rata_die_t const> r0, date_columns_t& u1) noexcept {
+    to_date_sorted(r0, u1.years, u1.months, u1.days);
+  }
+
+  /**
+   * @brief Returns the day of the week of a given rata die.
+   *
+   * Since epoch is a Wednesday, the result is (r0 + 3) % 7. When rata_die_t is at most 32-bit long
+   * the remainder is given by the EAF [1] n % 7 == 7 * (613566757 * n % 2^32) / 2^32 which holds
+   * for all n < 1431655766. (Two multiplications and no division.) Otherwise, r0 + 3 might
+   * overflow and the result is r0 % 7 + 3 (minus 7 if needed) where r0 % 7 is given by
+   * remainder_by_7.
+   *
+   * [1] https://arxiv.org/abs/2102.06959
+   *
+   * @param r0        The given rata die.
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max
+   */
+  weekday_t static constexpr
+  day_of_week(rata_die_t r0) noexcept {
+
+    if constexpr (sizeof(rata_die_t) == 8) {
+      auto const w = remainder_by_7(r0) + 3;
+      return weekday_t(w < 7 ? w : w - 7);
+    }
+
+    else {
+      auto const n = std::uint32_t(r0) + 3;
+      auto const u = std::uint32_t(613566757 * n);
+      return weekday_t(std::uint64_t(7) * u >> 32);
+    }
+  }
+
+  /**
+   * @brief Returns the days of the week of given rata dies.
+   *
+   * When rata_die_t is 32-bit long, SIMD kernels (if available) process the bulk of the input.
+   * Remaining elements are processed by the scalar day_of_week and the results match it bit for
+   * bit.
+   *
+   * @param r0        The given rata dies.
+   * @param w         Output days of the week.
+   * @pre             rata_die_min <= r0[i] && r0[i] <= rata_die_max for all i
+   * @pre             r0.size() <= w.size()
+   */
+  void static
+  day_of_week(std::span<rata_die_t const> r0, std::span<weekday_t> w) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4)
+      i = simd::day_of_week(r0.data(), r0.size(), 3, w.data());
+
+    for (; i < r0.size(); ++i)
+      w[i] = day_of_week(r0[i]);
+  }
+
+  /**
+   * @brief Returns the ordinal date corresponding to a given rata die.
+   *
+   * The first two stages are those of to_date and give the March-based year y0 and the day r2 of
+   * it. The first 306 days of y0 are March to December and January 1st is its 306th day (0-based).
+   * Hence, the day of the year is r2 - 305 (in year y0 + 1) when r2 >= 306 and, otherwise, r2 + 60
+   * (in year y0) plus one when y0 is leap. The latter is obtained from the century q1 and year of
+   * century q2 without further divisions. (Contrary to to_date, there's no need for the EAF giving
+   * month and day.)
+   *
+   * @param r0        The given rata die.
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max
+   */
+  ordinal_date_t static constexpr
+  to_ordinal_date(rata_die_t r0) noexcept {
+
+    auto const     n1  = 4 * r0 + 3;
+    auto const     q1  = [r0, n1]{
+      // See to_date.
+      if constexpr (sizeof(rata_die_t) == 8)
+        return rata_die_t((__uint128_t(r0) * 4137408090565272301u + 3103056067923954226u) >> 77);
+      else
+        return n1 / 146097;
+    }();
+    auto const     r1  = (n1 - 146097 * q1) / 4;
+
+    auto constexpr p32 = std::uint64_t(1) << 32;
+    auto const     n2  = 4 * r1 + 3;
+    auto const     u2  = std::uint64_t(2939745) * n2;
+    auto const     q2  = std::uint32_t(u2 / p32);
+    auto const     r2  = std::uint32_t(u2 % p32) / 2939745 / 4;
+
+    auto const     y0  = 100 * q1 + q2;
+    auto const     l0  = (q2 % 4 == 0) & ((q2 != 0) | (q1 % 4 == 0));
+
+    auto const     j   = r2 >= 306;
+    auto const     y1  = y0 + j;
+    auto const     d1  = j ? r2 - 305 : r2 + 60 + l0;
+
+    return { year_t(y1), day_of_year_t(d1) };
+  }
+
+  /**
+   * @brief Returns the rata die corresponding to a given ordinal date.
+   *
+   * This is the rata die of March 1st of the given year (see to_rata_die) shifted by the number of
+   * days from March 1st to the given day of the year.
+   *
+   * @param u1        The given ordinal date.
+   * @pre             1 <= u1.day && u1.day <= 365 + is_leap_year(u1.year) and the corresponding
+   *                  date is in [date_min, date_max]
+   */
+  rata_die_t static constexpr
+  from_ordinal_date(ordinal_date_t const& u1) noexcept {
+
+    auto const y1 = rata_die_t(u1.year);
+    auto const d1 = rata_die_t(u1.day);
+
+    auto const q1 = y1 / 100;
+    // 365 * y1 + y1 / 4 == 1461 * y1 / 4 but, contrary to the latter, the former only wraps around
+    // when the rata die of March 1st does. In this case, the final result is still correct in
+    // modular arithmetics since January and February precede March.
+    auto const yc = 365 * y1 + y1 / 4 - q1 + q1 / 4;
+    auto const l1 = (y1 % 4 == 0) & ((y1 != 100 * q1) | (q1 % 4 == 0));
+
+    return yc + d1 - 60 - l1;
+  }
+
+  /**
+   * @brief Returns the ISO 8601 week date corresponding to a given rata die.
+   *
+   * The week and ISO year are those of the Thursday in the same week as r0. Its day of the year is
+   * obtained from r0's by adding 4 minus the ISO day of the week and adjusting to the previous or
+   * next year in the rare cases where it falls outside r0's year. For all d in [1, 366],
+   * (d + 6) / 7 == (73 * d + 491) / 2^9.
+   *
+   * @param r0        The given rata die.
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max and the ISO year of r0 is
+   *                  representable by year_t
+   */
+  iso_week_date_t static constexpr
+  to_iso_week_date(rata_die_t r0) noexcept {
+
+    auto const u1 = to_ordinal_date(r0);
+    auto const w0 = day_of_week(r0);
+    auto const w1 = std::uint32_t(w0 == 0 ? 7 : w0);
+
+    auto       y1 = u1.year;
+    auto       d1 = std::int32_t(u1.day) + 4 - std::int32_t(w1);
+
+    if (d1 < 1) {
+      --y1;
+      d1 += 365 + is_leap_year(y1);
+    }
+    else if (d1 > 365 && d1 > 365 + is_leap_year(y1)) {
+      d1 -= 365 + is_leap_year(y1);
+      ++y1;
+    }
+
+    return { year_t(y1), week_t((73 * std::uint32_t(d1) + 491) / 512), weekday_t(w1) };
+  }
+
+  /**
+   * @brief Returns the rata die corresponding to a given ISO 8601 week date.
+   *
+   * January 4th is always in week 1. Hence, week 1 starts on the Monday preceding (or on) it.
+   *
+   * @param u1        The given week date.
+   * @pre             date_min <= (u1.year, 1, 4) && to_date(to_rata_die(u1)) <= date_max
+   * @pre             1 <= u1.week && u1.week <= 53 && 1 <= u1.weekday && u1.weekday <= 7
+   */
+  rata_die_t static constexpr
+  from_iso_week_date(iso_week_date_t const& u1) noexcept {
+
+    auto const r4 = from_ordinal_date(ordinal_date_t{u1.year, 4});
+    auto const w4 = day_of_week(r4);
+    auto const r1 = r4 - (w4 == 0 ? 6 : w4 - 1);
+
+    return r1 + 7 * (rata_die_t(u1.week) - 1) + (u1.weekday - 1);
+  }
+
+  /**
+   * @brief Converts the given rata dies into ordinal dates.
+   *
+   * @param r0        The given rata dies.
+   * @param u1        Output ordinal dates.
+   * @pre             rata_die_min <= r0[i] && r0[i] <= rata_die_max for all i
+   * @pre             r0.size() <= u1.size()
+   */
+  void static
+  to_ordinal_date(std::span<rata_die_t const> r0, std::span<ordinal_date_t> u1) noexcept {
+    for (std::size_t i = 0; i < r0.size(); ++i)
+      u1[i] = to_ordinal_date(r0[i]);
+  }
+
+  /**
+   * @brief Converts the given ordinal dates into rata dies.
+   *
+   * @param u1        The given ordinal dates.
+   * @param r1        Output rata dies.
+   * @pre             The preconditions of the scalar from_ordinal_date hold for all u1[i]
+   * @pre             u1.size() <= r1.size()
+   */
+  void static
+  from_ordinal_date(std::span<ordinal_date_t const> u1, std::span<rata_die_t> r1) noexcept {
+    for (std::size_t i = 0; i < u1.size(); ++i)
+      r1[i] = from_ordinal_date(u1[i]);
+  }
+
+  /**
+   * @brief Converts the given rata dies into ISO 8601 week dates.
+   *
+   * @param r0        The given rata dies.
+   * @param u1        Output week dates.
+   * @pre             The preconditions of the scalar to_iso_week_date hold for all r0[i]
+   * @pre             r0.size() <= u1.size()
+   */
+  void static
+  to_iso_week_date(std::span<rata_die_t const> r0, std::span<iso_week_date_t> u1) noexcept {
+    for (std::size_t i = 0; i < r0.size(); ++i)
+      u1[i] = to_iso_week_date(r0[i]);
+  }
+
+  /**
+   * @brief Converts the given ISO 8601 week dates into rata dies.
+   *
+   * @param u1        The given week dates.
+   * @param r1        Output rata dies.
+   * @pre             The preconditions of the scalar from_iso_week_date hold for all u1[i]
+   * @pre             u1.size() <= r1.size()
+   */
+  void static
+  from_iso_week_date(std::span<iso_week_date_t const> u1, std::span<rata_die_t> r1) noexcept {
+    for (std::size_t i = 0; i < u1.size(); ++i)
+      r1[i] = from_iso_week_date(u1[i]);
+  }
+
+  /**
+   * @brief Returns the date a given number of months after a given date.
+   *
+   * The day is clamped to the last day of the resulting month (e.g., 2000-Jan-31 plus one month is
+   * 2000-Feb-29). Months are counted from 0000-Jan, that is, u is in month k = 12 * y + m - 1 and
+   * the result in month k + n whose year and month are k / 12 and k % 12 + 1. When rata_die_t is
+   * 32-bit long, the division is given by the EAF [1] k / 12 == 2863311531 * k / 2^35, which holds
+   * for all k < 2^32. (No loop over months and, thanks to last_day_of_month, no branches.)
+   *
+   * [1] https://arxiv.org/abs/2102.06959
+   *
+   * @param u         The given date.
+   * @param n         The given number of months (negative to go backwards).
+   * @pre             date_min <= u && u <= date_max and the result is in [date_min, date_max]
+   */
+  date_t static constexpr
+  add_months(date_t const& u, std::make_signed_t<rata_die_t> n) noexcept {
+
+    auto const k = 12 * rata_die_t(u.year) + u.month - 1 + rata_die_t(n);
+    auto const y = [k]{
+      if constexpr (sizeof(rata_die_t) == 8)
+        return k / 12;
+      else
+        return rata_die_t(std::uint64_t(2863311531) * k >> 35);
+    }();
+    auto const m = month_t(k - 12 * y + 1);
+    auto const d = std::min(u.day, last_day_of_month(y, m));
+
+    return { year_t(y), m, d };
+  }
+
+  /**
+   * @brief Returns the rata die a given number of months after a given rata die.
+   *
+   * @param r0        The given rata die.
+   * @param n         The given number of months (negative to go backwards).
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max and the result is in
+   *                  [round_rata_die_min, round_rata_die_max]
+   */
+  rata_die_t static constexpr
+  add_months(rata_die_t r0, std::make_signed_t<rata_die_t> n) noexcept {
+    return to_rata_die(add_months(to_date(r0), n));
+  }
+
+  /**
+   * @brief Returns the date a given number of years after a given date.
+   *
+   * The day is clamped to the last day of the resulting month (i.e., February 29th becomes
+   * February 28th in common years).
+   *
+   * @param u         The given date.
+   * @param n         The given number of years (negative to go backwards).
+   * @pre             date_min <= u && u <= date_max and the result is in [date_min, date_max]
+   */
+  date_t static constexpr
+  add_years(date_t const& u, std::make_signed_t<rata_die_t> n) noexcept {
+    auto const y = rata_die_t(u.year) + rata_die_t(n);
+    return { year_t(y), u.month, std::min(u.day, last_day_of_month(y, u.month)) };
+  }
+
+  /**
+   * @brief Returns the rata die a given number of years after a given rata die.
+   *
+   * @param r0        The given rata die.
+   * @param n         The given number of years (negative to go backwards).
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max and the result is in
+   *                  [round_rata_die_min, round_rata_die_max]
+   */
+  rata_die_t static constexpr
+  add_years(rata_die_t r0, std::make_signed_t<rata_die_t> n) noexcept {
+    return add_months(r0, 12 * n);
+  }
+
+  /**
+   * @brief Adds a given number of months to given rata dies.
+   *
+   * When rata_die_t is 32-bit long, SIMD kernels (if available) process the bulk of the input.
+   * Remaining elements are processed by the scalar add_months and the results match it bit for
+   * bit.
+   *
+   * @param r0        The given rata dies.
+   * @param n         The given number of months (negative to go backwards).
+   * @param r1        Output rata dies.
+   * @pre             The preconditions of the scalar add_months hold for all r0[i]
+   * @pre             r0.size() <= r1.size()
+   */
+  void static
+  add_months(std::span<rata_die_t const> r0, std::make_signed_t<rata_die_t> n,
+    std::span<rata_die_t> r1) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4)
+      i = simd::add_months(r0.data(), r0.size(), std::uint32_t(n), 0, r1.data());
+
+    for (; i < r0.size(); ++i)
+      r1[i] = add_months(r0[i], n);
+  }
+
+  /**
+   * @brief Adds a given number of years to given rata dies.
+   *
+   * @param r0        The given rata dies.
+   * @param n         The given number of years (negative to go backwards).
+   * @param r1        Output rata dies.
+   * @pre             The preconditions of the scalar add_years hold for all r0[i]
+   * @pre             r0.size() <= r1.size()
+   */
+  void static
+  add_years(std::span<rata_die_t const> r0, std::make_signed_t<rata_die_t> n,
+    std::span<rata_die_t> r1) noexcept {
+    add_months(r0, 12 * n, r1);
+  }
+
+  /**
+   * @brief Returns the number of whole months from a given date to another.
+   *
+   * For u <= v, this is the largest k such that add_months(u, k) <= v and, for v < u, it is minus
+   * the number of whole months from v to u. For instance, from 2001-Jan-31 to 2001-Feb-28 there is
+   * one month (since the day is clamped to the end of February) but from 2001-Jan-30 to
+   * 2001-Feb-27 there is none.
+   *
+   * The number is k = 12 * (v.year - u.year) + v.month - u.month corrected by one when the day of
+   * the later date is smaller than that of the earlier and is not the last of its month. Both
+   * corrections are evaluated and selected by the sign of k without branches.
+   *
+   * @param u         The given first date.
+   * @param v         The given second date.
+   * @pre             date_min <= u && u <= date_max && date_min <= v && v <= date_max
+   */
+  std::make_signed_t<rata_die_t> static constexpr
+  months_between(date_t const& u, date_t const& v) noexcept {
+
+    using signed_t = std::make_signed_t<rata_die_t>;
+
+    auto const k = 12 * (signed_t(v.year) - signed_t(u.year)) + v.month - u.month;
+    auto const e = (u.day > v.day) & (v.day != last_day_of_month(v.year, v.month));
+    auto const f = (v.day > u.day) & (u.day != last_day_of_month(u.year, u.month));
+
+    return k - signed_t((k > 0) & e) + signed_t((k < 0) & f);
+  }
+
+  /**
+   * @brief Returns the number of whole months from a given rata die to another.
+   *
+   * @param r0        The given first rata die.
+   * @param r1        The given second rata die.
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max && rata_die_min <= r1 &&
+   *                  r1 <= rata_die_max
+   */
+  std::make_signed_t<rata_die_t> static constexpr
+  months_between(rata_die_t r0, rata_die_t r1) noexcept {
+    return months_between(to_date(r0), to_date(r1));
+  }
+
+  /**
+   * @brief Returns the number of whole years from a given date to another.
+   *
+   * Since add_years(u, n) == add_months(u, 12 * n), this is months_between(u, v) / 12 (rounded
+   * towards zero).
+   *
+   * @param u         The given first date.
+   * @param v         The given second date.
+   * @pre             date_min <= u && u <= date_max && date_min <= v && v <= date_max
+   */
+  std::make_signed_t<rata_die_t> static constexpr
+  years_between(date_t const& u, date_t const& v) noexcept {
+    return months_between(u, v) / 12;
+  }
+
+  /**
+   * @brief Returns the number of whole years from a given rata die to another.
+   *
+   * @param r0        The given first rata die.
+   * @param r1        The given second rata die.
+   * @pre             rata_die_min <= r0 && r0 <= rata_die_max && rata_die_min <= r1 &&
+   *                  r1 <= rata_die_max
+   */
+  std::make_signed_t<rata_die_t> static constexpr
+  years_between(rata_die_t r0, rata_die_t r1) noexcept {
+    return months_between(r0, r1) / 12;
+  }
+
+  /**
+   * @brief Returns the numbers of whole months between pairs of given rata dies.
+   *
+   * When rata_die_t is 32-bit long, SIMD kernels (if available) process the bulk of the input.
+   * Remaining elements are processed by the scalar months_between and the results match it bit for
+   * bit.
+   *
+   * @param r0        The given first rata dies.
+   * @param r1        The given second rata dies.
+   * @param k         Output numbers of months.
+   * @pre             The preconditions of the scalar months_between hold for all r0[i] and r1[i]
+   * @pre             r0.size() <= r1.size() && r0.size() <= k.size()
+   */
+  void static
+  months_between(std::span<rata_die_t const> r0, std::span<rata_die_t const> r1,
+    std::span<std::make_signed_t<rata_die_t>> k) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4)
+      i = simd::months_between(r0.data(), r1.data(), r0.size(), 0, k.data());
+
+    for (; i < r0.size(); ++i)
+      k[i] = months_between(r0[i], r1[i]);
+  }
+
+  /**
+   * @brief Returns the numbers of whole years between pairs of given rata dies.
+   *
+   * @param r0        The given first rata dies.
+   * @param r1        The given second rata dies.
+   * @param y         Output numbers of years.
+   * @pre             The preconditions of the scalar years_between hold for all r0[i] and r1[i]
+   * @pre             r0.size() <= r1.size() && r0.size() <= y.size()
+   */
+  void static
+  years_between(std::span<rata_die_t const> r0, std::span<rata_die_t const> r1,
+    std::span<std::make_signed_t<rata_die_t>> y) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4)
+      i = simd::years_between(r0.data(), r1.data(), r0.size(), 0, y.data());
+
+    for (; i < r0.size(); ++i)
+      y[i] = years_between(r0[i], r1[i]);
+  }
+
+ /**
+  * @brief  Minimum date allowed as input to to_rata_die.
+  */
+  date_t static constexpr date_min = epoch;
+
+  /**
+  * @brief  Maximum date allowed as input to to_rata_die.
+  */
+  date_t static constexpr date_max = []{
+
+    if constexpr (sizeof(rata_die_t) == 8) {
+      // to_date covers all 64-bit rata dies and to_rata_die is correct up to to_date(max).
+      using pugregorian_t = ugregorian_t<rata_die_t, rata_die_t>;
+      auto constexpr u = pugregorian_t::to_date(max<rata_die_t>);
+      if (max<year_t> <= u.year)
+        return max<date_t>;
+      return date_t{year_t(u.year), u.month, u.day};
+    }
+
+    else {
+      auto constexpr y = max<rata_die_t> / 1461;
+      if (max<year_t> <= y)
+        return max<date_t>;
+
+      return date_t{year_t(y + 1), month_t(2), day_t(28 + is_leap_year(y + 1))};
+    }
+  }();
+
+  /**
+   * @brief Minimum rata die allowed as input to to_date.
+   */
+  rata_die_t static constexpr rata_die_min = 0;
+
+  /**
+   * @brief Maximum rata die allowed as input to to_date.
+   */
+  rata_die_t static constexpr rata_die_max = []{
+    // Promoted algorithms are used to calculate rata_die_max and date_max. By promoting the year
+    // storage type to rata_die_t, they mitigate the risk of having intermediate year results that
+    // are not representable by year_t. This allows comparisons against max<year_t> to be safely
+    // performed on rata_die_max objects.
+    using pugregorian_t = ugregorian_t<rata_die_t, rata_die_t>;
+    using pyear_t       = typename pugregorian_t::year_t;
+    using pdate_t       = typename pugregorian_t::date_t;
+    auto constexpr n = sizeof(rata_die_t) == 8 ? max<rata_die_t> : (max<rata_die_t> - 3) / 4;
+    auto constexpr u = pugregorian_t::to_date(n);
+    auto constexpr v = pdate_t{ pyear_t(max<date_t>.year), max<date_t>.month, max<date_t>.day};
+    if (u <= v)
+      return n;
+    return pugregorian_t::to_rata_die(v);
+  }();
+
+  /**
+   * @brief Minimum rata die allowed as input to to_date for round trip.
+   */
+  rata_die_t static constexpr round_rata_die_min = std::max(rata_die_min, to_rata_die(date_min));
+
+  /**
+   * @brief Maximum rata die allowed as input to to_date for round trip.
+   */
+  rata_die_t static constexpr round_rata_die_max = std::min(rata_die_max, to_rata_die(date_max));
+
+  /**
+   * @brief Minimum date allowed as input to to_rata_die for round trip.
+   */
+  date_t static constexpr round_date_min = to_date(round_rata_die_min);
+
+  /**
+   * @brief Maximum date allowed as input to to_rata_die for round trip.
+   */
+  date_t static constexpr round_date_max = to_date(round_rata_die_max);
+
+}; // struct ugregorian_t
+
+/**
+ * @brief   The Unix epoch, i.e., 1970-Jan-01.
+ *
+ * @tparam  Y         Type of year data member.
+ */
+template <typename Y = std::int32_t>
+auto constexpr unix_epoch = date_t<Y>{1970, 1, 1};
+
+/**
+ * @brief   Gregorian calendar on signed integer types.
+ *
+ * This class is more configurable than ugregorian_t allowing negative years and rata dies. It also
+ * allows different epochs (by default, unix_epoch). This is a thin but not free layer class around
+ * ugregorian_t. Indeed, each function in gregorian_t simply adapts inputs and outputs (generally
  * through one addition and one subtraction) before/after delegating to a corresponding function in
  * ugregorian_t.
  *
  * @tparam  Y         Year storage type.
  * @tparam  R         Rata die storage type.
  * @tparam  e         Date used as epoch.
+ * @tparam  P         Policy for to_date (eaf_to_date_t or table_to_date_t).
  * @pre               std::is_signed_v<Y> && std::is_signed_v<R>
  */
-template <typename Y, typename R = Y, date_t<Y> e = unix_epoch<Y>>
+template <typename Y, typename R = Y, date_t<Y> e = unix_epoch<Y>, typename P = eaf_to_date_t>
 struct gregorian_t {
 
-  static_assert(std::is_signed_v<Y> && std::is_signed_v<R>);
+  static_assert(std::is_signed_v<Y> && std::is_signed_v<R>);
+
+  /**
+   * @brief Year storage type.
+   */
+  using year_t = Y;
+
+  /**
+   * @brief Rata die storage type.
+   */
+  using rata_die_t = R;
+
+  /**
+   * @brief Date storage type.
+   */
+  using date_t = ::date_t<year_t>;
+
+  /**
+   * @brief Columnar date storage type.
+   */
+  using date_columns_t = ::date_columns_t<year_t>;
+
+  /**
+   * @brief Packed date storage type.
+   */
+  using packed_date_t = ::packed_date_t<year_t>;
+
+  /**
+   * @brief Date and time storage type.
+   */
+  using date_time_t = ::date_time_t<year_t>;
+
+  /**
+   * @brief Precise date and time storage type.
+   */
+  using precise_date_time_t = ::precise_date_time_t<year_t>;
+
+  /**
+   * @brief Ordinal date storage type.
+   */
+  using ordinal_date_t = ::ordinal_date_t<year_t>;
+
+  /**
+   * @brief ISO 8601 week date storage type.
+   */
+  using iso_week_date_t = ::iso_week_date_t<year_t>;
+
+  /**
+   * @brief Policy for to_date.
+   */
+  using to_date_policy_t = P;
+
+  /**
+   * @brief Date used as epoch.
+   */
+  date_t static constexpr epoch = e;
+
+private:
+
+  // Preconditions related to representability of years by its storage type should be addressed in
+  // this class and not in the ugregorian_t helper. Therefore, to disable such constraints in the
+  // helper class, the storage type for years is set to be the same as for rata dies.
+  using uyear_t      = std::make_unsigned_t<rata_die_t>;
+  using urata_die_t  = std::make_unsigned_t<rata_die_t>;
+  using ugregorian_t = ::ugregorian_t<uyear_t, urata_die_t>;
+  using udate_t      = typename ugregorian_t::date_t;
+  using uordinal_t   = typename ugregorian_t::ordinal_date_t;
+  using uiso_week_t  = typename ugregorian_t::iso_week_date_t;
+
+  // Number of days added to seconds before splitting them into days and seconds of day. This is
+  // the largest number of days whose count of seconds is representable by seconds_t. Hence, the
+  // shifted seconds are non-negative and representable by std::uint64_t for all s >= -86400 *
+  // days_offset.
+  std::uint64_t static constexpr days_offset = max<seconds_t> / 86400;
+
+  // Similar to days_offset for ticks, with p ticks per second.
+  template <std::uint32_t p>
+  std::uint64_t static constexpr ticks_days_offset = max<std::int64_t> / 86400 / p;
+
+public:
+
+  struct offset_t {
+    uyear_t     year;
+    urata_die_t rata_die;
+  };
+
+  offset_t static constexpr offset = []{
+    auto constexpr q = epoch.year / 400;
+    auto constexpr r = epoch.year % 400;
+    // Recall that % returns the remainder of truncated division and thus, r is in [-399, 399].
+    // Hence, (r, epoch.month, epoch.day) might be outside the domain of ugregorian_t::to_rata_die.
+    // To mitigate this issue we take y = r + 400 which is in [1, 799]. Therefore, (y, epoch.month,
+    // epoch.day) is in the domain of ugregorian_t::to_rata_die.
+    auto constexpr u = udate_t{r + 400, epoch.month, epoch.day};
+    // Since adding 400 years to a date increases its rata die by 146097, we subtract this value to
+    // get the correct result. This number might be "negative" but this is not a problem because
+    // following calculations are under modular arithmetics.
+    auto constexpr n     = ugregorian_t::to_rata_die(u) - 146097;
+    // When ugregorian_t covers all unsigned rata dies (64-bit long), t is also capped to guarantee
+    // that min<rata_die_t> <= -n2_e3.
+    auto constexpr t     = std::min(ugregorian_t::rata_die_max / 146097 / 2,
+      urata_die_t(max<rata_die_t> - 146097) / 146097);
+    auto constexpr z2    = 400 * (q - t);
+    auto constexpr n2_e3 = 146097 * t + n;
+
+    return offset_t{z2, n2_e3};
+  }();
+
+private:
+
+  /**
+   * @brief Adjusts rata die from signed to unsigned.
+   *
+   * @param n         The given rata die.
+   */
+  urata_die_t static constexpr
+  to_urata_die(rata_die_t n) noexcept {
+    return n + offset.rata_die;
+  }
+
+  /**
+   * @brief Adjusts rata die from unsigned to signed.
+   *
+   * @param n         The given rata die.
+   */
+  rata_die_t static constexpr
+  from_urata_die(urata_die_t n) noexcept {
+    return n - offset.rata_die;
+  }
+
+  /**
+   * @brief Adjusts date from signed to unsigned.
+   *
+   * @param u         The given date.
+   */
+  udate_t static constexpr
+  to_udate(date_t const& u) noexcept {
+    return { u.year - offset.year, u.month, u.day };
+  }
+
+  /**
+   * @brief Adjusts date from unsigned to signed.
+   *
+   * @param u         The given date.
+   */
+  date_t static constexpr
+  from_udate(udate_t const& u) noexcept {
+    return { year_t(u.year + offset.year), u.month, u.day };
+  }
+
+public:
+
+  /**
+   * @brief Returns the rata die corresponding to a given date.
+   *
+   * @param u2        The given date.
+   * @pre             date_min <= u && u <= date_max
+   */
+  rata_die_t static constexpr
+  to_rata_die(date_t const& u2) noexcept {
+    return from_urata_die(ugregorian_t::to_rata_die(to_udate(u2)));
+  }
+
+  /**
+   * @brief Returns the rata die corresponding to a given packed date.
+   *
+   * @param p2        The given packed date.
+   * @pre             date_min <= p2.unpack() && p2.unpack() <= date_max
+   */
+  rata_die_t static constexpr
+  to_rata_die(packed_date_t const& p2) noexcept {
+    return to_rata_die(p2.unpack());
+  }
+
+  /**
+   * @brief Converts the given dates into rata dies.
+   *
+   * When rata_die_t is 32-bit long and year_t is 16 or 32-bit long, SIMD kernels (if available)
+   * process the bulk of the input, deinterleaving years, months and days and applying offsets in
+   * registers. Remaining elements are processed by the scalar to_rata_die and the results match it
+   * bit for bit.
+   *
+   * @param u2        The given dates.
+   * @param n3        Output rata dies.
+   * @pre             date_min <= u2[i] && u2[i] <= date_max for all i
+   * @pre             u2.size() <= n3.size()
+   */
+  void static
+  to_rata_die(std::span<date_t const> u2, std::span<rata_die_t> n3) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4 && (sizeof(year_t) == 2 || sizeof(year_t) == 4))
+      i = simd::to_rata_die(u2.data(), u2.size(), -offset.year, -offset.rata_die,
+        reinterpret_cast<urata_die_t*>(n3.data()));
+
+    for (; i < u2.size(); ++i)
+      n3[i] = to_rata_die(u2[i]);
+  }
+
+  /**
+   * @brief Converts the given dates into rata dies.
+   *
+   * The i-th date is (y2[i], m2[i], d2[i]). When rata_die_t is 32-bit long and year_t is 16 or
+   * 32-bit long, SIMD kernels (if available) process the bulk of the input. Remaining elements are
+   * processed by the scalar to_rata_die and the results match it bit for bit.
+   *
+   * @param y2        The given years.
+   * @param m2        The given months.
+   * @param d2        The given days.
+   * @param n3        Output rata dies.
+   * @pre             date_min <= (y2[i], m2[i], d2[i]) && (y2[i], m2[i], d2[i]) <= date_max for
+   *                  all i
+   * @pre             y2.size() <= m2.size() && y2.size() <= d2.size() && y2.size() <= n3.size()
+   */
+  void static
+  to_rata_die(std::span<year_t const> y2, std::span<month_t const> m2, std::span<day_t const> d2,
+    std::span<rata_die_t> n3) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4 && (sizeof(year_t) == 2 || sizeof(year_t) == 4))
+      i = simd::to_rata_die(y2.data(), m2.data(), d2.data(), y2.size(), -offset.year,
+        -offset.rata_die, reinterpret_cast<urata_die_t*>(n3.data()));
+
+    for (; i < y2.size(); ++i)
+      n3[i] = to_rata_die(date_t{y2[i], m2[i], d2[i]});
+  }
+
+  /**
+   * @brief Converts the given dates, stored in columns, into rata dies.
+   *
+   * @param u2        The given dates.
+   * @param n3        Output rata dies.
+   * @pre             date_min <= u2[i] && u2[i] <= date_max for all i
+   * @pre             u2.size() <= n3.size()
+   */
+  void static
+  to_rata_die(date_columns_t const& u2, std::span<rata_die_t> n3) noexcept {
+    to_rata_die(u2.years, u2.months, u2.days, n3);
+  }
+
+  /**
+   * @brief Parses a date in ISO 8601 extended format (see ::from_chars) and returns its rata die.
+   *
+   * Dates outside [date_min, date_max] are reported as std::errc::result_out_of_range.
+   *
+   * @param first     Pointer to the beginning of the buffer.
+   * @param last      Pointer to the end of the buffer.
+   * @param n3        Output rata die.
+   */
+  std::from_chars_result static constexpr
+  from_chars(char const* first, char const* last, rata_die_t& n3) noexcept {
+
+    date_t u2;
+    auto const r = ::from_chars(first, last, u2);
+
+    if (r.ec != std::errc())
+      return r;
+
+    if (u2 < date_min || date_max < u2)
+      return { first, std::errc::result_out_of_range };
+
+    n3 = to_rata_die(u2);
+    return r;
+  }
+
+  /**
+   * @brief Parses fixed-width dates in ISO 8601 extended format (YYYY-MM-DD) into rata dies and
+   * flags which of them are valid.
+   *
+   * The i-th date is made of the first ten characters of chars[width * i, width * (i + 1)) and
+   * the remaining ones (e.g., delimiters) are ignored. The number of dates is the number of i such
+   * that width * i + 10 <= chars.size(). Hence, the last record might be shorter than width.
+   *
+   * Bit i % 64 of valid[i / 64] is set if, and only if, the i-th date is valid and in [date_min,
+   * date_max]. Unused bits of the last word are cleared. Results for invalid inputs are unspecified
+   * but evaluating them is safe. Dates are parsed by the branchless SWAR
+   * ::from_chars(char const*, date_t&).
+   *
+   * @param chars     The given characters.
+   * @param width     The given width of records.
+   * @param n3        Output rata dies.
+   * @param valid     Output bitmap of valid inputs.
+   * @pre             width >= 10
+   * @pre             The number of dates is at most n3.size() and 64 * valid.size().
+   */
+  void static
+  from_chars(std::span<char const> chars, std::size_t width, std::span<rata_die_t> n3,
+    std::span<std::uint64_t> valid) noexcept {
+
+    auto const size = chars.size() < 10 ? 0 : (chars.size() - 10) / width + 1;
+
+    for (std::size_t i = 0; i < size; i += 64) {
+
+      auto const    end  = std::min(size, i + 64);
+      std::uint64_t word = 0;
+
+      for (std::size_t j = i; j < end; ++j) {
+        date_t     u2;
+        auto const ok = ::from_chars(chars.data() + width * j, u2) & (date_min <= u2) &
+          (u2 <= date_max);
+        n3[j] = to_rata_die(u2);
+        word |= std::uint64_t(ok) << (j - i);
+      }
+
+      valid[i / 64] = word;
+    }
+  }
+
+  /**
+   * @brief Returns the date corresponding to a given rata die.
+   *
+   * When P is table_to_date_t, rata dies in its window are converted by table look up.
+   *
+   * @param n3        The given rata die.
+   * @pre             rata_die_min <= n && n <= rata_die_max
+   */
+  date_t static constexpr
+  to_date(rata_die_t n3) noexcept {
+
+    if constexpr (!std::is_same_v<P, eaf_to_date_t>) {
+      date_t u2;
+      if (P::template to_date<gregorian_t>(n3, u2))
+        return u2;
+    }
+
+    return from_udate(ugregorian_t::to_date(to_urata_die(n3)));
+  }
+
+  /**
+   * @brief Returns the packed date corresponding to a given rata die.
+   *
+   * @param n3        The given rata die.
+   * @pre             rata_die_min <= n && n <= rata_die_max
+   */
+  packed_date_t static constexpr
+  to_packed_date(rata_die_t n3) noexcept {
+    return packed_date_t(to_date(n3));
+  }
+
+  /**
+   * @brief Converts the given rata dies into dates.
+   *
+   * The i-th date is stored in y1[i], m1[i] and d1[i]. When rata_die_t is 32-bit long and year_t is
+   * 16 or 32-bit long, SIMD kernels (if available) process the bulk of the input with offsets
+   * applied in registers. Remaining elements are processed by the scalar to_date and the results
+   * match it bit for bit.
+   *
+   * @param n3        The given rata dies.
+   * @param y1        Output years.
+   * @param m1        Output months.
+   * @param d1        Output days.
+   * @pre             rata_die_min <= n3[i] && n3[i] <= rata_die_max for all i
+   * @pre             n3.size() <= y1.size() && n3.size() <= m1.size() && n3.size() <= d1.size()
+   */
+  void static
+  to_date(std::span<rata_die_t const> n3, std::span<year_t> y1, std::span<month_t> m1,
+    std::span<day_t> d1) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4 && (sizeof(year_t) == 2 || sizeof(year_t) == 4))
+      i = simd::to_date(reinterpret_cast<urata_die_t const*>(n3.data()), n3.size(),
+        offset.rata_die, offset.year, y1.data(), m1.data(), d1.data());
+
+    for (; i < n3.size(); ++i) {
+      auto const u = to_date(n3[i]);
+      y1[i] = u.year;
+      m1[i] = u.month;
+      d1[i] = u.day;
+    }
+  }
+
+  /**
+   * @brief Converts the given rata dies into dates stored in columns.
+   *
+   * @param n3        The given rata dies.
+   * @param u2        Output dates.
+   * @pre             rata_die_min <= n3[i] && n3[i] <= rata_die_max for all i
+   * @pre             n3.size() <= u2.size()
+   */
+  void static
+  to_date(std::span<rata_die_t const> n3, date_columns_t& u2) noexcept {
+    to_date(n3, u2.years, u2.months, u2.days);
+  }
+
+  /**
+   * @brief Converts the given rata dies, expected to be (nearly) sorted, into dates.
+   *
+   * This delegates to to_date_month_runs which falls back to to_date outside runs of rata dies in
+   * the same or consecutive months.
+   *
+   * @param n3        The given rata dies.
+   * @param y1        Output years.
+   * @param m1        Output months.
+   * @param d1        Output days.
+   * @pre             rata_die_min <= n3[i] && n3[i] <= rata_die_max for all i
+   * @pre             n3.size() <= y1.size() && n3.size() <= m1.size() && n3.size() <= d1.size()
+   */
+  void static
+  to_date_sorted(std::span<rata_die_t const> n3, std::span<year_t> y1, std::span<month_t> m1,
+    std::span<day_t> d1) noexcept {
+    to_date_month_runs<gregorian_t>(n3, y1, m1, d1);
+  }
+
+  /**
+   * @brief Converts the given rata dies, expected to be (nearly) sorted, into dates stored in
+   * columns.
+   *
+   * @param n3        The given rata dies.
+   * @param u2        Output dates.
+   * @pre             rata_die_min <= n3[i] && n3[i] <= rata_die_max for all i
+   * @pre             n3.size() <= u2.size()
+   */
+  void static
+  to_date_sorted(std::span<rata_die_t const> n3, date_columns_t& u2) noexcept {
+    to_date_sorted(n3, u2.years, u2.months, u2.days);
+  }
+
+  /**
+   * @brief Returns the day of the week of a given rata die.
+   *
+   * This delegates to ugregorian_t::day_of_week which adds 3 to the adjusted rata die. Hence, the
+   * rata die is added offset.rata_die + 3, a single constant evaluated at compile time.
+   *
+   * @param n3        The given rata die.
+   * @pre             rata_die_min <= n3 && n3 <= rata_die_max
+   */
+  weekday_t static constexpr
+  day_of_week(rata_die_t n3) noexcept {
+    return ugregorian_t::day_of_week(to_urata_die(n3));
+  }
+
+  /**
+   * @brief Returns the days of the week of given rata dies.
+   *
+   * When rata_die_t is 32-bit long, SIMD kernels (if available) process the bulk of the input.
+   * Remaining elements are processed by the scalar day_of_week and the results match it bit for
+   * bit.
+   *
+   * @param n3        The given rata dies.
+   * @param w         Output days of the week.
+   * @pre             rata_die_min <= n3[i] && n3[i] <= rata_die_max for all i
+   * @pre             n3.size() <= w.size()
+   */
+  void static
+  day_of_week(std::span<rata_die_t const> n3, std::span<weekday_t> w) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4)
+      i = simd::day_of_week(reinterpret_cast<urata_die_t const*>(n3.data()), n3.size(),
+        offset.rata_die + 3, w.data());
+
+    for (; i < n3.size(); ++i)
+      w[i] = day_of_week(n3[i]);
+  }
 
   /**
-   * @brief Year storage type.
+   * @brief Returns the ordinal date corresponding to a given rata die.
+   *
+   * @param n3        The given rata die.
+   * @pre             rata_die_min <= n3 && n3 <= rata_die_max
    */
-  using year_t = Y;
+  ordinal_date_t static constexpr
+  to_ordinal_date(rata_die_t n3) noexcept {
+    auto const u = ugregorian_t::to_ordinal_date(to_urata_die(n3));
+    return { year_t(u.year + offset.year), u.day };
+  }
 
   /**
-   * @brief Rata die storage type.
+   * @brief Returns the rata die corresponding to a given ordinal date.
+   *
+   * @param u2        The given ordinal date.
+   * @pre             1 <= u2.day && u2.day <= 365 + is_leap_year(u2.year) and the corresponding
+   *                  date is in [date_min, date_max]
    */
-  using rata_die_t = R;
+  rata_die_t static constexpr
+  from_ordinal_date(ordinal_date_t const& u2) noexcept {
+    return from_urata_die(ugregorian_t::from_ordinal_date(uordinal_t{u2.year - offset.year,
+      u2.day}));
+  }
 
   /**
-   * @brief Date storage type.
+   * @brief Returns the ISO 8601 week date corresponding to a given rata die.
+   *
+   * @param n3        The given rata die.
+   * @pre             rata_die_min <= n3 && n3 <= rata_die_max and the ISO year of n3 is
+   *                  representable by year_t
    */
-  using date_t = ::date_t<year_t>;
+  iso_week_date_t static constexpr
+  to_iso_week_date(rata_die_t n3) noexcept {
+    auto const u = ugregorian_t::to_iso_week_date(to_urata_die(n3));
+    return { year_t(u.year + offset.year), u.week, u.weekday };
+  }
 
   /**
-   * @brief Date used as epoch.
+   * @brief Returns the rata die corresponding to a given ISO 8601 week date.
+   *
+   * @param u2        The given week date.
+   * @pre             date_min <= (u2.year, 1, 4) && to_date(to_rata_die(u2)) <= date_max
+   * @pre             1 <= u2.week && u2.week <= 53 && 1 <= u2.weekday && u2.weekday <= 7
    */
-  date_t static constexpr epoch = e;
+  rata_die_t static constexpr
+  from_iso_week_date(iso_week_date_t const& u2) noexcept {
+    return from_urata_die(ugregorian_t::from_iso_week_date(uiso_week_t{u2.year - offset.year,
+      u2.week, u2.weekday}));
+  }
 
-private:
+  /**
+   * @brief Converts the given rata dies into ordinal dates.
+   *
+   * @param n3        The given rata dies.
+   * @param u2        Output ordinal dates.
+   * @pre             rata_die_min <= n3[i] && n3[i] <= rata_die_max for all i
+   * @pre             n3.size() <= u2.size()
+   */
+  void static
+  to_ordinal_date(std::span<rata_die_t const> n3, std::span<ordinal_date_t> u2) noexcept {
+    for (std::size_t i = 0; i < n3.size(); ++i)
+      u2[i] = to_ordinal_date(n3[i]);
+  }
 
-  // Preconditions related to representability of years by its storage type should be addressed in
-  // this class and not in the ugregorian_t helper. Therefore, to disable such constraints in the
-  // helper class, the storage type for years is set to be the same as for rata dies.
-  using uyear_t      = std::make_unsigned_t<rata_die_t>;
-  using urata_die_t  = std::make_unsigned_t<rata_die_t>;
-  using ugregorian_t = ::ugregorian_t<uyear_t, urata_die_t>;
-  using udate_t      = typename ugregorian_t::date_t;
+  /**
+   * @brief Converts the given ordinal dates into rata dies.
+   *
+   * @param u2        The given ordinal dates.
+   * @param n3        Output rata dies.
+   * @pre             The preconditions of the scalar from_ordinal_date hold for all u2[i]
+   * @pre             u2.size() <= n3.size()
+   */
+  void static
+  from_ordinal_date(std::span<ordinal_date_t const> u2, std::span<rata_die_t> n3) noexcept {
+    for (std::size_t i = 0; i < u2.size(); ++i)
+      n3[i] = from_ordinal_date(u2[i]);
+  }
 
-public:
+  /**
+   * @brief Converts the given rata dies into ISO 8601 week dates.
+   *
+   * @param n3        The given rata dies.
+   * @param u2        Output week dates.
+   * @pre             The preconditions of the scalar to_iso_week_date hold for all n3[i]
+   * @pre             n3.size() <= u2.size()
+   */
+  void static
+  to_iso_week_date(std::span<rata_die_t const> n3, std::span<iso_week_date_t> u2) noexcept {
+    for (std::size_t i = 0; i < n3.size(); ++i)
+      u2[i] = to_iso_week_date(n3[i]);
+  }
 
-  struct offset_t {
-    uyear_t     year;
-    urata_die_t rata_die;
-  };
+  /**
+   * @brief Converts the given ISO 8601 week dates into rata dies.
+   *
+   * @param u2        The given week dates.
+   * @param n3        Output rata dies.
+   * @pre             The preconditions of the scalar from_iso_week_date hold for all u2[i]
+   * @pre             u2.size() <= n3.size()
+   */
+  void static
+  from_iso_week_date(std::span<iso_week_date_t const> u2, std::span<rata_die_t> n3) noexcept {
+    for (std::size_t i = 0; i < u2.size(); ++i)
+      n3[i] = from_iso_week_date(u2[i]);
+  }
 
-  offset_t static constexpr offset = []{
-    auto constexpr q = epoch.year / 400;
-    auto constexpr r = epoch.year % 400;
-    // Recall that % returns the remainder of truncated division and thus, r is in [-399, 399].
-    // Hence, (r, epoch.month, epoch.day) might be outside the domain of ugregorian_t::to_rata_die.
-    // To mitigate this issue we take y = r + 400 which is in [1, 799]. Therefore, (y, epoch.month,
-    // epoch.day) is in the domain of ugregorian_t::to_rata_die.
-    auto constexpr u = udate_t{r + 400, epoch.month, epoch.day};
-    // Since adding 400 years to a date increases its rata die by 146097, we subtract this value to
-    // get the correct result. This number might be "negative" but this is not a problem because
-    // following calculations are under modular arithmetics.
-    auto constexpr n     = ugregorian_t::to_rata_die(u) - 146097;
-    auto constexpr t     = ugregorian_t::rata_die_max / 146097 / 2;
-    auto constexpr z2    = 400 * (q - t);
-    auto constexpr n2_e3 = 146097 * t + n;
+  /**
+   * @brief Returns the date a given number of months after a given date.
+   *
+   * The day is clamped to the last day of the resulting month (see ugregorian_t::add_months).
+   *
+   * @param u2        The given date.
+   * @param n         The given number of months (negative to go backwards).
+   * @pre             date_min <= u2 && u2 <= date_max and the result is in [date_min, date_max]
+   */
+  date_t static constexpr
+  add_months(date_t const& u2, rata_die_t n) noexcept {
+    return from_udate(ugregorian_t::add_months(to_udate(u2), n));
+  }
 
-    return offset_t{z2, n2_e3};
-  }();
+  /**
+   * @brief Returns the rata die a given number of months after a given rata die.
+   *
+   * @param n3        The given rata die.
+   * @param n         The given number of months (negative to go backwards).
+   * @pre             rata_die_min <= n3 && n3 <= rata_die_max and the result is in
+   *                  [round_rata_die_min, round_rata_die_max]
+   */
+  rata_die_t static constexpr
+  add_months(rata_die_t n3, rata_die_t n) noexcept {
+    return from_urata_die(ugregorian_t::add_months(to_urata_die(n3), n));
+  }
 
-private:
+  /**
+   * @brief Returns the date a given number of years after a given date.
+   *
+   * The day is clamped to the last day of the resulting month (see ugregorian_t::add_years).
+   *
+   * @param u2        The given date.
+   * @param n         The given number of years (negative to go backwards).
+   * @pre             date_min <= u2 && u2 <= date_max and the result is in [date_min, date_max]
+   */
+  date_t static constexpr
+  add_years(date_t const& u2, rata_die_t n) noexcept {
+    return from_udate(ugregorian_t::add_years(to_udate(u2), n));
+  }
 
   /**
-   * @brief Adjusts rata die from signed to unsigned.
+   * @brief Returns the rata die a given number of years after a given rata die.
    *
-   * @param n         The given rata die.
+   * @param n3        The given rata die.
+   * @param n         The given number of years (negative to go backwards).
+   * @pre             rata_die_min <= n3 && n3 <= rata_die_max and the result is in
+   *                  [round_rata_die_min, round_rata_die_max]
    */
-  urata_die_t static constexpr
-  to_urata_die(rata_die_t n) noexcept {
-    return n + offset.rata_die;
+  rata_die_t static constexpr
+  add_years(rata_die_t n3, rata_die_t n) noexcept {
+    return add_months(n3, 12 * n);
   }
 
   /**
-   * @brief Adjusts rata die from unsigned to signed.
+   * @brief Adds a given number of months to given rata dies.
    *
-   * @param n         The given rata die.
+   * When rata_die_t is 32-bit long, SIMD kernels (if available) process the bulk of the input with
+   * offsets applied in registers. Remaining elements are processed by the scalar add_months and the
+   * results match it bit for bit.
+   *
+   * @param n3        The given rata dies.
+   * @param n         The given number of months (negative to go backwards).
+   * @param n4        Output rata dies.
+   * @pre             The preconditions of the scalar add_months hold for all n3[i]
+   * @pre             n3.size() <= n4.size()
+   */
+  void static
+  add_months(std::span<rata_die_t const> n3, rata_die_t n, std::span<rata_die_t> n4) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4)
+      i = simd::add_months(reinterpret_cast<urata_die_t const*>(n3.data()), n3.size(),
+        std::uint32_t(n), offset.rata_die, reinterpret_cast<urata_die_t*>(n4.data()));
+
+    for (; i < n3.size(); ++i)
+      n4[i] = add_months(n3[i], n);
+  }
+
+  /**
+   * @brief Adds a given number of years to given rata dies.
+   *
+   * @param n3        The given rata dies.
+   * @param n         The given number of years (negative to go backwards).
+   * @param n4        Output rata dies.
+   * @pre             The preconditions of the scalar add_years hold for all n3[i]
+   * @pre             n3.size() <= n4.size()
+   */
+  void static
+  add_years(std::span<rata_die_t const> n3, rata_die_t n, std::span<rata_die_t> n4) noexcept {
+    add_months(n3, 12 * n, n4);
+  }
+
+  /**
+   * @brief Returns the number of whole months from a given date to another (see
+   *        ugregorian_t::months_between).
+   *
+   * @param u2        The given first date.
+   * @param v2        The given second date.
+   * @pre             date_min <= u2 && u2 <= date_max && date_min <= v2 && v2 <= date_max
    */
   rata_die_t static constexpr
-  from_urata_die(urata_die_t n) noexcept {
-    return n - offset.rata_die;
+  months_between(date_t const& u2, date_t const& v2) noexcept {
+    return ugregorian_t::months_between(to_udate(u2), to_udate(v2));
   }
 
   /**
-   * @brief Adjusts date from signed to unsigned.
+   * @brief Returns the number of whole months from a given rata die to another.
+   *
+   * @param n3        The given first rata die.
+   * @param m3        The given second rata die.
+   * @pre             rata_die_min <= n3 && n3 <= rata_die_max && rata_die_min <= m3 &&
+   *                  m3 <= rata_die_max
+   */
+  rata_die_t static constexpr
+  months_between(rata_die_t n3, rata_die_t m3) noexcept {
+    return ugregorian_t::months_between(to_urata_die(n3), to_urata_die(m3));
+  }
+
+  /**
+   * @brief Returns the number of whole years from a given date to another (see
+   *        ugregorian_t::years_between).
+   *
+   * @param u2        The given first date.
+   * @param v2        The given second date.
+   * @pre             date_min <= u2 && u2 <= date_max && date_min <= v2 && v2 <= date_max
+   */
+  rata_die_t static constexpr
+  years_between(date_t const& u2, date_t const& v2) noexcept {
+    return ugregorian_t::years_between(to_udate(u2), to_udate(v2));
+  }
+
+  /**
+   * @brief Returns the number of whole years from a given rata die to another.
+   *
+   * @param n3        The given first rata die.
+   * @param m3        The given second rata die.
+   * @pre             rata_die_min <= n3 && n3 <= rata_die_max && rata_die_min <= m3 &&
+   *                  m3 <= rata_die_max
+   */
+  rata_die_t static constexpr
+  years_between(rata_die_t n3, rata_die_t m3) noexcept {
+    return ugregorian_t::years_between(to_urata_die(n3), to_urata_die(m3));
+  }
+
+  /**
+   * @brief Returns the numbers of whole months between pairs of given rata dies.
+   *
+   * When rata_die_t is 32-bit long, SIMD kernels (if available) process the bulk of the input with
+   * offsets applied in registers. Remaining elements are processed by the scalar months_between and
+   * the results match it bit for bit.
+   *
+   * @param n3        The given first rata dies.
+   * @param m3        The given second rata dies.
+   * @param k         Output numbers of months.
+   * @pre             The preconditions of the scalar months_between hold for all n3[i] and m3[i]
+   * @pre             n3.size() <= m3.size() && n3.size() <= k.size()
+   */
+  void static
+  months_between(std::span<rata_die_t const> n3, std::span<rata_die_t const> m3,
+    std::span<rata_die_t> k) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4)
+      i = simd::months_between(reinterpret_cast<urata_die_t const*>(n3.data()),
+        reinterpret_cast<urata_die_t const*>(m3.data()), n3.size(), offset.rata_die, k.data());
+
+    for (; i < n3.size(); ++i)
+      k[i] = months_between(n3[i], m3[i]);
+  }
+
+  /**
+   * @brief Returns the numbers of whole years between pairs of given rata dies.
+   *
+   * @param n3        The given first rata dies.
+   * @param m3        The given second rata dies.
+   * @param y         Output numbers of years.
+   * @pre             The preconditions of the scalar years_between hold for all n3[i] and m3[i]
+   * @pre             n3.size() <= m3.size() && n3.size() <= y.size()
+   */
+  void static
+  years_between(std::span<rata_die_t const> n3, std::span<rata_die_t const> m3,
+    std::span<rata_die_t> y) noexcept {
+
+    std::size_t i = 0;
+
+    if constexpr (sizeof(rata_die_t) == 4)
+      i = simd::years_between(reinterpret_cast<urata_die_t const*>(n3.data()),
+        reinterpret_cast<urata_die_t const*>(m3.data()), n3.size(), offset.rata_die, y.data());
+
+    for (; i < n3.size(); ++i)
+      y[i] = years_between(n3[i], m3[i]);
+  }
+
+  /**
+   * @brief Returns the date and time corresponding to a given number of seconds since the epoch.
+   *
+   * For the default epoch, s is the Unix time. The floored division of s by 86400 is evaluated as
+   * an unsigned division (i.e., a multiplication and shifts) of s shifted by days_offset days. The
+   * rata die and the seconds of day thus obtained are passed to to_date and to_time_of_day which
+   * are inlined, keeping all intermediate results in registers.
+   *
+   * @param s         The given number of seconds.
+   * @pre             seconds_min <= s && s <= seconds_max
+   */
+  date_time_t static constexpr
+  to_date_time(seconds_t s) noexcept {
+    auto const u = std::uint64_t(s) + 86400 * days_offset;
+    auto const n = u / 86400;
+    auto const r = std::uint32_t(u - 86400 * n);
+    return { to_date(rata_die_t(n - days_offset)), to_time_of_day(r) };
+  }
+
+  /**
+   * @brief Converts the given numbers of seconds since the epoch into dates and times.
+   *
+   * This is a loop over the scalar to_date_time. (The floored division of 64-bit seconds needs
+   * 64-bit multiply-highs which are not provided by SSE, AVX2 or AVX-512.)
+   *
+   * @param s         The given numbers of seconds.
+   * @param u         Output dates and times.
+   * @pre             seconds_min <= s[i] && s[i] <= seconds_max for all i
+   * @pre             s.size() <= u.size()
+   */
+  void static
+  to_date_time(std::span<seconds_t const> s, std::span<date_time_t> u) noexcept {
+    for (std::size_t i = 0; i < s.size(); ++i)
+      u[i] = to_date_time(s[i]);
+  }
+
+  /**
+   * @brief Returns the precise date and time corresponding to a given number of ticks since the
+   * epoch.
+   *
+   * For instance, when p == 1000000000 and epoch is the default, t is the Unix time in nanoseconds.
+   * As in to_date_time, t is shifted by a number of days to make it non-negative. Then, t is split
+   * into seconds and fraction by ticks_to_seconds, a multiply-high. The seconds are split into days
+   * and seconds of day, which are passed to to_date and to_time_of_day.
+   *
+   * @tparam  p       Number of ticks per second.
+   * @param   t       The given number of ticks.
+   * @pre             p == 1000 || p == 1000000 || p == 1000000000
+   * @pre             ticks_min<p> <= t && t <= ticks_max<p>
+   */
+  template <std::uint32_t p>
+  precise_date_time_t static constexpr
+  to_precise_date_time(std::int64_t t) noexcept {
+    auto constexpr b = ticks_days_offset<p>;
+    auto const     u = std::uint64_t(t) + 86400 * std::uint64_t(p) * b;
+    auto const     q = ticks_to_seconds<p>(u);
+    auto const     f = std::uint32_t(u - p * q);
+    auto const     n = q / 86400;
+    auto const     r = std::uint32_t(q - 86400 * n);
+    return { to_date(rata_die_t(n - b)), to_time_of_day(r), f };
+  }
+
+  /**
+   * @brief Converts the given numbers of ticks since the epoch into precise dates and times.
+   *
+   * This is a loop over the scalar to_precise_date_time. (See to_date_time on the lack of SIMD.)
+   *
+   * @tparam  p       Number of ticks per second.
+   * @param   t       The given numbers of ticks.
+   * @param   u       Output precise dates and times.
+   * @pre             p == 1000 || p == 1000000 || p == 1000000000
+   * @pre             ticks_min<p> <= t[i] && t[i] <= ticks_max<p> for all i
+   * @pre             t.size() <= u.size()
+   */
+  template <std::uint32_t p>
+  void static
+  to_precise_date_time(std::span<std::int64_t const> t, std::span<precise_date_time_t> u) noexcept {
+    for (std::size_t i = 0; i < t.size(); ++i)
+      u[i] = to_precise_date_time<p>(t[i]);
+  }
+
+  /**
+   * @brief Returns the number of seconds since the epoch corresponding to a given date and time.
+   *
+   * This is the inverse of to_date_time. The result of to_rata_die is scaled and added to the
+   * seconds of day in std::uint64_t, where wrap arounds are harmless, and the only conversion back
+   * to seconds_t happens at the end.
    *
    * @param u         The given date.
+   * @param h         The given hour.
+   * @param m         The given minute.
+   * @param s         The given second.
+   * @pre             date_min <= u && u <= date_max && h < 24 && m < 60 && s < 60
+   * @pre             The result is in [seconds_min, seconds_max].
    */
-  udate_t static constexpr
-  to_udate(date_t const& u) noexcept {
-    return { u.year - offset.year, u.month, u.day };
+  seconds_t static constexpr
+  to_seconds(date_t const& u, hour_t h, minute_t m, second_t s) noexcept {
+    auto const n = std::uint64_t(to_rata_die(u));
+    auto const t = 3600 * std::uint32_t(h) + 60 * std::uint32_t(m) + std::uint32_t(s);
+    return seconds_t(86400 * n + t);
+  }
+
+  /**
+   * @brief Returns the number of seconds since the epoch corresponding to a given date and time.
+   *
+   * @param u         The given date and time.
+   * @pre             See to_seconds(date_t const&, hour_t, minute_t, second_t).
+   */
+  seconds_t static constexpr
+  to_seconds(date_time_t const& u) noexcept {
+    return to_seconds(u.date, u.time.hour, u.time.minute, u.time.second);
+  }
+
+  /**
+   * @brief Converts the given dates and times into numbers of seconds since the epoch.
+   *
+   * The i-th date and time is (y[i], m[i], d[i]) and (h[i], mi[i], s[i]).
+   *
+   * @param y         The given years.
+   * @param m         The given months.
+   * @param d         The given days.
+   * @param h         The given hours.
+   * @param mi        The given minutes.
+   * @param s         The given seconds.
+   * @param n         Output numbers of seconds.
+   * @pre             See to_seconds(date_t const&, hour_t, minute_t, second_t) for all i.
+   * @pre             y.size() <= m.size(), d.size(), h.size(), mi.size(), s.size() and n.size().
+   */
+  void static
+  to_seconds(std::span<year_t const> y, std::span<month_t const> m, std::span<day_t const> d,
+    std::span<hour_t const> h, std::span<minute_t const> mi, std::span<second_t const> s,
+    std::span<seconds_t> n) noexcept {
+    for (std::size_t i = 0; i < y.size(); ++i)
+      n[i] = to_seconds(date_t{y[i], m[i], d[i]}, h[i], mi[i], s[i]);
+  }
+
+  /**
+   * @brief Converts the given dates and times into numbers of seconds since the epoch and flags
+   * which of them are valid.
+   *
+   * Bit i % 64 of valid[i / 64] is set if, and only if, the i-th input meets the preconditions of
+   * to_seconds, that is, its fields are in range (e.g., d[i] <= last_day_of_month(y[i], m[i])) and
+   * the result is in [seconds_min, seconds_max]. Unused bits of the last word are cleared. Results
+   * for invalid inputs are unspecified but evaluating them is safe. Checks are branchless and
+   * combined with bitwise operators.
+   *
+   * @param y         The given years.
+   * @param m         The given months.
+   * @param d         The given days.
+   * @param h         The given hours.
+   * @param mi        The given minutes.
+   * @param s         The given seconds.
+   * @param n         Output numbers of seconds.
+   * @param valid     Output bitmap of valid inputs.
+   * @pre             y.size() <= m.size(), d.size(), h.size(), mi.size(), s.size() and n.size().
+   * @pre             (y.size() + 63) / 64 <= valid.size()
+   */
+  void static
+  to_seconds(std::span<year_t const> y, std::span<month_t const> m, std::span<day_t const> d,
+    std::span<hour_t const> h, std::span<minute_t const> mi, std::span<second_t const> s,
+    std::span<seconds_t> n, std::span<std::uint64_t> valid) noexcept {
+
+    // Validation of results is performed on seconds shifted by days_offset days which are
+    // non-negative and, when in range, do not wrap around.
+    auto constexpr shift = 86400 * days_offset;
+    auto constexpr lo    = std::uint64_t(seconds_min) + shift;
+    auto constexpr hi    = std::uint64_t(seconds_max) + shift;
+
+    for (std::size_t i = 0; i < y.size(); i += 64) {
+
+      auto const    end  = std::min(y.size(), i + 64);
+      std::uint64_t word = 0;
+
+      for (std::size_t j = i; j < end; ++j) {
+
+        auto const u  = date_t{y[j], m[j], d[j]};
+        auto const k  = std::uint64_t(to_rata_die(u)) + days_offset;
+        auto const t  = 3600 * std::uint32_t(h[j]) + 60 * std::uint32_t(mi[j]) +
+          std::uint32_t(s[j]);
+        auto const w  = 86400 * k + t;
+
+        n[j] = seconds_t(w - shift);
+
+        auto const ok = (std::uint32_t(m[j] - 1) < 12) &
+          (std::uint32_t(d[j] - 1) < last_day_of_month(y[j], m[j])) & (h[j] < 24) & (mi[j] < 60) &
+          (s[j] < 60) & (date_min <= u) & (u <= date_max) & (k <= max<std::uint64_t> / 86400) &
+          (lo <= w) & (w <= hi);
+
+        word |= std::uint64_t(ok) << (j - i);
+      }
+
+      valid[i / 64] = word;
+    }
+  }
+
+  /**
+   * @brief Maximum number of characters written by to_rfc_3339.
+   *
+   * This is the length of the longest date, the time ("Thh:mm:ss"), up to nine digits of fraction
+   * and the offset ("+hh:mm").
+   */
+  std::size_t static constexpr rfc_3339_size = iso_8601_date_size<year_t> + 25;
+
+  /**
+   * @brief Writes a given number of ticks since the epoch as an RFC 3339 timestamp (e.g.,
+   * 2024-03-10T18:04:56.123456789+05:30) to a given buffer without bounds checking.
+   *
+   * The number of ticks is shifted by the offset and passed to to_precise_date_time. The date is
+   * written by ::to_chars and so are the time of day and the offset, through to_two_digits. The
+   * fraction is written with 3, 6 or 9 digits (depending on p) given by the EAF
+   * n / 10 == 429496730 * n / 2^32 and n % 10 == 429496730 * n % 2^32 / 429496730. A zero offset
+   * is written as 'Z'. No memory is allocated.
+   *
+   * @tparam  p       Number of ticks per second.
+   * @param   first   Pointer to the buffer.
+   * @param   t       The given number of ticks.
+   * @param   offset  The given offset from UTC in minutes.
+   * @pre             p == 1000 || p == 1000000 || p == 1000000000
+   * @pre             [first, first + rfc_3339_size) is a valid range
+   * @pre             -1440 < offset && offset < 1440
+   * @pre             ticks_min<p> <= t + 60 * p * offset && t + 60 * p * offset <= ticks_max<p>
+   * @return          Pointer one past the last written character.
+   */
+  template <std::uint32_t p = 1000000000>
+  char static constexpr*
+  to_rfc_3339(char* first, std::int64_t t, std::int32_t offset = 0) noexcept {
+
+    auto constexpr digits = p == 1000 ? 3 : p == 1000000 ? 6 : 9;
+    auto constexpr p32    = std::uint64_t(1) << 32;
+
+    auto const u = to_precise_date_time<p>(t + std::int64_t(p) * 60 * offset);
+
+    first    = ::to_chars(first, u.date);
+    *first++ = 'T';
+    first    = ::to_chars(first, u.time);
+    *first   = '.';
+
+    auto f = u.fraction;
+    for (auto i = digits; i > 0; --i) {
+      auto const w = std::uint64_t(429496730) * f;
+      first[i] = char('0' + std::uint32_t(w % p32) / 429496730);
+      f = std::uint32_t(w / p32);
+    }
+    first += digits + 1;
+
+    if (offset == 0) {
+      *first++ = 'Z';
+      return first;
+    }
+
+    auto const a = std::uint32_t(offset < 0 ? -offset : offset);
+    auto const h = a / 60;
+    auto const w = to_two_digits(std::uint64_t(h) | std::uint64_t(a - 60 * h) << 16);
+
+    first[0] = offset < 0 ? '-' : '+';
+    first[1] = char(w      );
+    first[2] = char(w >>  8);
+    first[3] = ':';
+    first[4] = char(w >> 16);
+    first[5] = char(w >> 24);
+
+    return first + 6;
   }
 
-  /**
-   * @brief Adjusts date from unsigned to signed.
-   *
-   * @param u         The given date.
-   */
-  date_t static constexpr
-  from_udate(udate_t const& u) noexcept {
-    return { year_t(u.year + offset.year), u.month, u.day };
-  }
+  /**
+   * @brief Writes a given number of ticks since the epoch as an RFC 3339 timestamp to a given
+   * buffer.
+   *
+   * Returned values and errors are as in ::to_chars(char*, char*, date_t<Y> const&).
+   *
+   * @tparam  p       Number of ticks per second.
+   * @param   first   Pointer to the beginning of the buffer.
+   * @param   last    Pointer to the end of the buffer.
+   * @param   t       The given number of ticks.
+   * @param   offset  The given offset from UTC in minutes.
+   * @pre             See to_rfc_3339(char*, std::int64_t, std::int32_t).
+   */
+  template <std::uint32_t p = 1000000000>
+  std::to_chars_result static constexpr
+  to_rfc_3339(char* first, char* last, std::int64_t t, std::int32_t offset = 0) noexcept {
+
+    if (std::size_t(last - first) >= rfc_3339_size)
+      return { to_rfc_3339<p>(first, t, offset), std::errc() };
+
+    char buffer[rfc_3339_size] = {};
+    auto const end  = to_rfc_3339<p>(buffer, t, offset);
+    auto const size = end - buffer;
+
+    if (last - first < size)
+      return { last, std::errc::value_too_large };
+
+    return { std::copy(buffer, end, first), std::errc() };
+  }
+
+  /**
+   * @brief Parses an RFC 3339 timestamp (e.g., 2024-03-10T12:34:56.123456789Z or
+   * 2024-03-10T18:04:56+05:30) from a given buffer into a number of ticks since the epoch and the
+   * offset from UTC.
+   *
+   * The date is parsed by ::from_chars (SWAR for four-digit years) and must be in [date_min,
+   * date_max]. The date and time separator is 'T', 't' or ' '. The time of day is parsed by the
+   * SWAR ::from_chars. The fraction is optional and might have any number of digits but only the
+   * first 3, 6 or 9 (depending on p) are used, that is, it's truncated. The offset is 'Z', 'z' or
+   * +hh:mm or -hh:mm. Leap seconds are rejected. No memory is allocated.
+   *
+   * Returned values and errors are as in ::from_chars(char const*, char const*, date_t<Y>&). In
+   * particular, std::errc::result_out_of_range is reported when the number of ticks is not
+   * representable by std::int64_t. Outputs are only modified on success.
+   *
+   * @tparam  p       Number of ticks per second.
+   * @param   first   Pointer to the beginning of the buffer.
+   * @param   last    Pointer to the end of the buffer.
+   * @param   t       Output number of ticks.
+   * @param   offset  Output offset from UTC in minutes.
+   * @pre             p == 1000 || p == 1000000 || p == 1000000000
+   */
+  template <std::uint32_t p = 1000000000>
+  std::from_chars_result static constexpr
+  from_rfc_3339(char const* first, char const* last, std::int64_t& t, std::int32_t& offset)
+    noexcept {
+
+    auto constexpr digits   = p == 1000 ? 3 : p == 1000000 ? 6 : 9;
+    auto constexpr is_digit = [](char c) { return '0' <= c && c <= '9'; };
+
+    date_t     u;
+    auto const r = ::from_chars(first, last, u);
+
+    if (r.ec != std::errc())
+      return { first, r.ec };
+
+    auto c = r.ptr;
+
+    time_of_day_t v;
+    if (last - c < 10 || (*c != 'T' && *c != 't' && *c != ' ') || !::from_chars(c + 1, v))
+      return { first, std::errc::invalid_argument };
+
+    c += 9;
+
+    std::uint32_t f = 0;
+
+    if (*c == '.') {
+
+      auto const b = ++c;
+      for (; c != last && is_digit(*c); ++c)
+        if (c - b < digits)
+          f = 10 * f + std::uint32_t(*c - '0');
+
+      if (c == b)
+        return { first, std::errc::invalid_argument };
+
+      for (auto n = c - b; n < digits; ++n)
+        f *= 10;
+    }
+
+    if (c == last)
+      return { first, std::errc::invalid_argument };
+
+    std::int32_t o = 0;
+
+    if (*c == 'Z' || *c == 'z')
+      ++c;
+
+    else if (*c == '+' || *c == '-') {
+
+      if (last - c < 6 || !is_digit(c[1]) || !is_digit(c[2]) || c[3] != ':' || !is_digit(c[4]) ||
+        !is_digit(c[5]))
+        return { first, std::errc::invalid_argument };
+
+      auto const h = 10 * (c[1] - '0') + (c[2] - '0');
+      auto const m = 10 * (c[4] - '0') + (c[5] - '0');
 
-public:
+      if (h >= 24 || m >= 60)
+        return { first, std::errc::invalid_argument };
 
-  /**
-   * @brief Returns the rata die corresponding to a given date.
-   *
-   * @param u2        The given date.
-   * @pre             date_min <= u && u <= date_max
-   */
-  rata_die_t static constexpr
-  to_rata_die(date_t const& u2) noexcept {
-    return from_urata_die(ugregorian_t::to_rata_die(to_udate(u2)));
+      o  = *c == '-' ? -(60 * h + m) : 60 * h + m;
+      c += 6;
+    }
+
+    else
+      return { first, std::errc::invalid_argument };
+
+    if (u < date_min || date_max < u)
+      return { first, std::errc::result_out_of_range };
+
+    // Evaluated in 128-bit arithmetics to detect results that are not representable.
+    auto const s = __int128_t(to_rata_die(u)) * 86400 + 3600 * v.hour + 60 * v.minute + v.second -
+      60 * o;
+    auto const x = s * p + f;
+
+    if (x < min<std::int64_t> || x > max<std::int64_t>)
+      return { first, std::errc::result_out_of_range };
+
+    t      = std::int64_t(x);
+    offset = o;
+
+    return { c, std::errc() };
   }
 
   /**
-   * @brief Returns the date corresponding to a given rata die.
+   * @brief Parses an RFC 3339 timestamp from a given buffer into a number of ticks since the
+   * epoch.
    *
-   * @param n3        The given rata die.
-   * @pre             rata_die_min <= n && n <= rata_die_max
+   * @tparam  p       Number of ticks per second.
+   * @param   first   Pointer to the beginning of the buffer.
+   * @param   last    Pointer to the end of the buffer.
+   * @param   t       Output number of ticks.
+   * @pre             See from_rfc_3339(char const*, char const*, std::int64_t&, std::int32_t&).
    */
-  date_t static constexpr
-  to_date(rata_die_t n3) noexcept {
-    return from_udate(ugregorian_t::to_date(to_urata_die(n3)));
+  template <std::uint32_t p = 1000000000>
+  std::from_chars_result static constexpr
+  from_rfc_3339(char const* first, char const* last, std::int64_t& t) noexcept {
+    std::int32_t offset;
+    return from_rfc_3339<p>(first, last, t, offset);
   }
 
  /**
@@ -540,8 +3606,12 @@ public:
   */
   date_t static constexpr date_max = []{
     auto constexpr x = to_udate(max<date_t>);
-    if (ugregorian_t::date_max < x)
-      return from_udate(ugregorian_t::date_max);
+    // Dates whose rata dies are greater than max<rata_die_t> must be excluded.
+    auto constexpr n = to_urata_die(max<rata_die_t>);
+    auto constexpr u = n < ugregorian_t::to_rata_die(ugregorian_t::date_max) ?
+      ugregorian_t::to_date(n) : ugregorian_t::date_max;
+    if (u < x)
+      return from_udate(u);
     return max<date_t>;
   }();
 
@@ -564,7 +3634,7 @@ public:
    */
   rata_die_t static constexpr rata_die_max = []{
     if (ugregorian_t::to_date(ugregorian_t::rata_die_max) < to_udate(max<date_t>))
-      return from_urata_die(ugregorian_t::rata_die_max);
+      return from_urata_die(std::min(ugregorian_t::rata_die_max, to_urata_die(max<rata_die_t>)));
     return to_rata_die(max<date_t>);
   }();
 
@@ -588,4 +3658,799 @@ public:
    */
   date_t static constexpr round_date_max = to_date(round_rata_die_max);
 
+  /**
+   * @brief Minimum number of seconds allowed as input to to_date_time.
+   */
+  seconds_t static constexpr seconds_min =
+    86400 * std::max(seconds_t(rata_die_min), -seconds_t(days_offset));
+
+  /**
+   * @brief Maximum number of seconds allowed as input to to_date_time.
+   */
+  seconds_t static constexpr seconds_max = []{
+    auto constexpr n = std::min(seconds_t(rata_die_max), seconds_t(days_offset) - 1);
+    if (n < rata_die_max)
+      return max<seconds_t>;
+    return 86400 * n + 86399;
+  }();
+
+  /**
+   * @brief Minimum number of seconds allowed as input to to_date_time for round trip.
+   */
+  seconds_t static constexpr round_seconds_min =
+    86400 * std::max(seconds_t(round_rata_die_min), -seconds_t(days_offset));
+
+  /**
+   * @brief Maximum number of seconds allowed as input to to_date_time for round trip.
+   */
+  seconds_t static constexpr round_seconds_max = []{
+    auto constexpr n = std::min(seconds_t(round_rata_die_max), seconds_t(days_offset) - 1);
+    if (n < round_rata_die_max)
+      return max<seconds_t>;
+    return 86400 * n + 86399;
+  }();
+
+  /**
+   * @brief Minimum number of ticks allowed as input to to_precise_date_time<p>.
+   *
+   * @tparam  p       Number of ticks per second.
+   */
+  template <std::uint32_t p>
+  std::int64_t static constexpr ticks_min = 86400 * std::int64_t(p) *
+    std::max(std::int64_t(rata_die_min), -std::int64_t(ticks_days_offset<p>));
+
+  /**
+   * @brief Maximum number of ticks allowed as input to to_precise_date_time<p>.
+   *
+   * @tparam  p       Number of ticks per second.
+   */
+  template <std::uint32_t p>
+  std::int64_t static constexpr ticks_max = []{
+    auto constexpr n = std::min(std::int64_t(rata_die_max), std::int64_t(ticks_days_offset<p>) - 1);
+    if (n < rata_die_max)
+      return max<std::int64_t>;
+    return 86400 * std::int64_t(p) * (n + 1) - 1;
+  }();
+
 }; // struct gregorian_t
+
+/**
+ * @brief   View of the dates corresponding to rata dies in [first, last).
+ *
+ * Only the construction of iterators (and jumps) calls C::to_date. Incrementing and decrementing
+ * iterators step the day and carry into month and year using last_day_of_month (only evaluated
+ * when the day is at least 28). Iterators model std::random_access_iterator and dereferencing
+ * them yields dates by value. Hence, as for std::views::iota, their legacy iterator_category is
+ * std::input_iterator_tag and jumps backwards should use std::ranges::prev or operator -.
+ *
+ * @tparam  C         The calendar (ugregorian_t or gregorian_t).
+ * @pre               C::rata_die_min <= first && first <= last && last <= C::rata_die_max
+ */
+template <typename C>
+class days_view_t : public std::ranges::view_interface<days_view_t<C>> {
+
+public:
+
+  /**
+   * @brief Rata die storage type.
+   */
+  using rata_die_t = typename C::rata_die_t;
+
+  /**
+   * @brief Date storage type.
+   */
+  using date_t = typename C::date_t;
+
+  /**
+   * @brief Iterator over dates.
+   */
+  class iterator {
+
+  public:
+
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = date_t;
+    using difference_type   = std::int64_t;
+
+    /**
+     * @brief Creates an iterator to rata die 0 of C.
+     */
+    iterator() = default;
+
+    /**
+     * @brief Creates an iterator to a given rata die.
+     *
+     * @param n       The given rata die.
+     * @pre           C::rata_die_min <= n && n <= C::rata_die_max
+     */
+    explicit constexpr
+    iterator(rata_die_t n) noexcept : n_{n}, u_{C::to_date(n)} {
+    }
+
+    /**
+     * @brief Returns the current date.
+     */
+    date_t constexpr
+    operator *() const noexcept {
+      return u_;
+    }
+
+    /**
+     * @brief Returns the date k days after the current one.
+     *
+     * @param k       The number of days.
+     */
+    date_t constexpr
+    operator [](difference_type k) const noexcept {
+      return C::to_date(rata_die_t(n_ + k));
+    }
+
+    /**
+     * @brief Returns the current rata die.
+     */
+    rata_die_t constexpr
+    rata_die() const noexcept {
+      return n_;
+    }
+
+    /**
+     * @brief Moves to the next day.
+     */
+    iterator constexpr&
+    operator ++() noexcept {
+      ++n_;
+      if (u_.day < 28 || u_.day < last_day_of_month(year_t(u_.year % 400), u_.month))
+        ++u_.day;
+      else if (u_.month < 12) {
+        ++u_.month;
+        u_.day = 1;
+      }
+      else {
+        ++u_.year;
+        u_.month = 1;
+        u_.day   = 1;
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Moves to the previous day.
+     */
+    iterator constexpr&
+    operator --() noexcept {
+      --n_;
+      if (u_.day > 1)
+        --u_.day;
+      else if (u_.month > 1) {
+        --u_.month;
+        u_.day = last_day_of_month(year_t(u_.year % 400), u_.month);
+      }
+      else {
+        --u_.year;
+        u_.month = 12;
+        u_.day   = 31;
+      }
+      return *this;
+    }
+
+    iterator constexpr
+    operator ++(int) noexcept {
+      auto const i = *this;
+      ++*this;
+      return i;
+    }
+
+    iterator constexpr
+    operator --(int) noexcept {
+      auto const i = *this;
+      --*this;
+      return i;
+    }
+
+    /**
+     * @brief Moves k days forward (through C::to_date).
+     *
+     * @param k       The number of days.
+     */
+    iterator constexpr&
+    operator +=(difference_type k) noexcept {
+      n_ = rata_die_t(n_ + k);
+      u_ = C::to_date(n_);
+      return *this;
+    }
+
+    /**
+     * @brief Moves k days backward (through C::to_date).
+     *
+     * @param k       The number of days.
+     */
+    iterator constexpr&
+    operator -=(difference_type k) noexcept {
+      return *this += -k;
+    }
+
+    friend iterator constexpr
+    operator +(iterator i, difference_type k) noexcept {
+      return i += k;
+    }
+
+    friend iterator constexpr
+    operator +(difference_type k, iterator i) noexcept {
+      return i += k;
+    }
+
+    friend iterator constexpr
+    operator -(iterator i, difference_type k) noexcept {
+      return i -= k;
+    }
+
+    friend difference_type constexpr
+    operator -(iterator const& i, iterator const& j) noexcept {
+      return difference_type(i.n_) - difference_type(j.n_);
+    }
+
+    friend bool constexpr
+    operator ==(iterator const& i, iterator const& j) noexcept {
+      return i.n_ == j.n_;
+    }
+
+    friend std::strong_ordering constexpr
+    operator <=>(iterator const& i, iterator const& j) noexcept {
+      return i.n_ <=> j.n_;
+    }
+
+  private:
+
+    using year_t = typename C::year_t;
+
+    rata_die_t n_ = 0;
+    date_t     u_ = C::epoch;
+  }; // class iterator
+
+  /**
+   * @brief Creates an empty view.
+   */
+  days_view_t() = default;
+
+  /**
+   * @brief Creates a view of the dates corresponding to rata dies in [first, last).
+   *
+   * @param first     The first rata die.
+   * @param last      The rata die past the last one.
+   * @pre             C::rata_die_min <= first && first <= last && last <= C::rata_die_max
+   */
+  constexpr
+  days_view_t(rata_die_t first, rata_die_t last) noexcept : first_{first}, last_{last} {
+  }
+
+  /**
+   * @brief Returns an iterator to the first date.
+   */
+  iterator constexpr
+  begin() const noexcept {
+    return first_;
+  }
+
+  /**
+   * @brief Returns an iterator past the last date.
+   */
+  iterator constexpr
+  end() const noexcept {
+    return last_;
+  }
+
+  /**
+   * @brief Returns the number of dates.
+   */
+  std::size_t constexpr
+  size() const noexcept {
+    return std::size_t(last_.rata_die() - first_.rata_die());
+  }
+
+private:
+
+  iterator first_;
+  iterator last_;
+}; // class days_view_t
+
+/**
+ * @brief   View of the months in [first, last) and the ranges of their rata dies.
+ *
+ * Each element is a month_info_t holding the year, the month, the rata die of its first day and its
+ * length (in days). Only the construction of iterators (and jumps) calls C::to_rata_die.
+ * Incrementing and decrementing iterators step the month and obtain lengths from the month count
+ * (979 * m0 - 2919) / 32 of to_rata_die (with m0 = 3 for March, ..., 14 for February) except for
+ * February whose length depends on the year. As for days_view_t, the legacy iterator_category is
+ * std::input_iterator_tag and jumps backwards should use std::ranges::prev or operator -.
+ *
+ * @tparam  C         The calendar (ugregorian_t or gregorian_t).
+ * @pre               C::date_min <= first && first <= last && last <= C::date_max (where first
+ *                    and last are the first days of the months)
+ */
+template <typename C>
+class months_view_t : public std::ranges::view_interface<months_view_t<C>> {
+
+public:
+
+  /**
+   * @brief Year storage type.
+   */
+  using year_t = typename C::year_t;
+
+  /**
+   * @brief Rata die storage type.
+   */
+  using rata_die_t = typename C::rata_die_t;
+
+  /**
+   * @brief A month and the range of its rata dies [first, first + length).
+   */
+  struct month_info_t {
+    year_t     year;
+    month_t    month;
+    rata_die_t first;
+    rata_die_t length;
+
+    friend bool constexpr
+    operator ==(month_info_t const&, month_info_t const&) noexcept = default;
+  };
+
+  /**
+   * @brief Iterator over months.
+   */
+  class iterator {
+
+  public:
+
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = month_info_t;
+    using difference_type   = std::int64_t;
+
+    /**
+     * @brief Creates an iterator to the month of the epoch of C.
+     */
+    iterator() = default;
+
+    /**
+     * @brief Creates an iterator to a given month.
+     *
+     * @param y       The year of the given month.
+     * @param m       The given month.
+     * @pre           C::date_min <= date_t{y, m, 1} && date_t{y, m, 1} <= C::date_max
+     */
+    constexpr
+    iterator(year_t y, month_t m) noexcept : y_{y}, m_{m},
+      n_{C::to_rata_die(typename C::date_t{y, m, 1})} {
+    }
+
+    /**
+     * @brief Returns the current month.
+     */
+    month_info_t constexpr
+    operator *() const noexcept {
+      return {y_, m_, n_, length(y_, m_)};
+    }
+
+    /**
+     * @brief Returns the month k months after the current one.
+     *
+     * @param k       The number of months.
+     */
+    month_info_t constexpr
+    operator [](difference_type k) const noexcept {
+      return *(*this + k);
+    }
+
+    /**
+     * @brief Moves to the next month.
+     */
+    iterator constexpr&
+    operator ++() noexcept {
+      n_ = rata_die_t(n_ + length(y_, m_));
+      if (m_ < 12)
+        ++m_;
+      else {
+        ++y_;
+        m_ = 1;
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Moves to the previous month.
+     */
+    iterator constexpr&
+    operator --() noexcept {
+      if (m_ > 1)
+        --m_;
+      else {
+        --y_;
+        m_ = 12;
+      }
+      n_ = rata_die_t(n_ - length(y_, m_));
+      return *this;
+    }
+
+    iterator constexpr
+    operator ++(int) noexcept {
+      auto const i = *this;
+      ++*this;
+      return i;
+    }
+
+    iterator constexpr
+    operator --(int) noexcept {
+      auto const i = *this;
+      --*this;
+      return i;
+    }
+
+    /**
+     * @brief Moves k months forward (through C::to_rata_die).
+     *
+     * @param k       The number of months.
+     */
+    iterator constexpr&
+    operator +=(difference_type k) noexcept {
+      auto const t = difference_type(m_) - 1 + k;
+      auto const q = t / 12 - (t % 12 < 0);
+      return *this = iterator(year_t(y_ + q), month_t(t - 12 * q + 1));
+    }
+
+    /**
+     * @brief Moves k months backward (through C::to_rata_die).
+     *
+     * @param k       The number of months.
+     */
+    iterator constexpr&
+    operator -=(difference_type k) noexcept {
+      return *this += -k;
+    }
+
+    friend iterator constexpr
+    operator +(iterator i, difference_type k) noexcept {
+      return i += k;
+    }
+
+    friend iterator constexpr
+    operator +(difference_type k, iterator i) noexcept {
+      return i += k;
+    }
+
+    friend iterator constexpr
+    operator -(iterator i, difference_type k) noexcept {
+      return i -= k;
+    }
+
+    friend difference_type constexpr
+    operator -(iterator const& i, iterator const& j) noexcept {
+      return 12 * (difference_type(i.y_) - difference_type(j.y_)) + i.m_ - j.m_;
+    }
+
+    friend bool constexpr
+    operator ==(iterator const& i, iterator const& j) noexcept {
+      return i.n_ == j.n_;
+    }
+
+    friend std::strong_ordering constexpr
+    operator <=>(iterator const& i, iterator const& j) noexcept {
+      return i.n_ <=> j.n_;
+    }
+
+  private:
+
+    /**
+     * @brief Returns the length of a given month.
+     *
+     * @param y       The year of the given month.
+     * @param m       The given month.
+     */
+    rata_die_t static constexpr
+    length(year_t y, month_t m) noexcept {
+      auto const m0 = rata_die_t(m < 3 ? m + 12 : m);
+      if (m0 == 14)
+        return 28 + is_leap_year(year_t(y % 400));
+      return (979 * (m0 + 1) - 2919) / 32 - (979 * m0 - 2919) / 32;
+    }
+
+    year_t     y_ = C::epoch.year;
+    month_t    m_ = C::epoch.month;
+    rata_die_t n_ = C::to_rata_die(typename C::date_t{C::epoch.year, C::epoch.month, 1});
+  }; // class iterator
+
+  /**
+   * @brief Creates an empty view.
+   */
+  months_view_t() = default;
+
+  /**
+   * @brief Creates a view of the months in [first, last).
+   *
+   * @param first_year    The year of the first month.
+   * @param first_month   The first month.
+   * @param last_year     The year of the month past the last one.
+   * @param last_month    The month past the last one.
+   * @pre                 C::date_min <= first && first <= last && last <= C::date_max (where
+   *                      first and last are the first days of the months)
+   */
+  constexpr
+  months_view_t(year_t first_year, month_t first_month, year_t last_year, month_t last_month)
+    noexcept : first_{first_year, first_month}, last_{last_year, last_month} {
+  }
+
+  /**
+   * @brief Returns an iterator to the first month.
+   */
+  iterator constexpr
+  begin() const noexcept {
+    return first_;
+  }
+
+  /**
+   * @brief Returns an iterator past the last month.
+   */
+  iterator constexpr
+  end() const noexcept {
+    return last_;
+  }
+
+  /**
+   * @brief Returns the number of months.
+   */
+  std::size_t constexpr
+  size() const noexcept {
+    return std::size_t(last_ - first_);
+  }
+
+private:
+
+  iterator first_;
+  iterator last_;
+}; // class months_view_t
+
+/**
+ * @brief   View of the years in [first, last) and the ranges of their rata dies.
+ *
+ * Each element is a year_info_t holding the year, the rata die of its January 1st and its length
+ * (in days). Only the construction of iterators (and jumps) calls C::to_rata_die. Incrementing
+ * and decrementing iterators step the year and obtain lengths from is_leap_year. As for
+ * days_view_t, the legacy iterator_category is std::input_iterator_tag and jumps backwards should
+ * use std::ranges::prev or operator -.
+ *
+ * @tparam  C         The calendar (ugregorian_t or gregorian_t).
+ * @pre               C::date_min <= first && first <= last && last <= C::date_max (where first
+ *                    and last are the January 1st of the years)
+ */
+template <typename C>
+class years_view_t : public std::ranges::view_interface<years_view_t<C>> {
+
+public:
+
+  /**
+   * @brief Year storage type.
+   */
+  using year_t = typename C::year_t;
+
+  /**
+   * @brief Rata die storage type.
+   */
+  using rata_die_t = typename C::rata_die_t;
+
+  /**
+   * @brief A year and the range of its rata dies [first, first + length).
+   */
+  struct year_info_t {
+    year_t     year;
+    rata_die_t first;
+    rata_die_t length;
+
+    friend bool constexpr
+    operator ==(year_info_t const&, year_info_t const&) noexcept = default;
+  };
+
+  /**
+   * @brief Iterator over years.
+   */
+  class iterator {
+
+  public:
+
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = year_info_t;
+    using difference_type   = std::int64_t;
+
+    /**
+     * @brief Creates an iterator to the year of the epoch of C.
+     */
+    iterator() = default;
+
+    /**
+     * @brief Creates an iterator to a given year.
+     *
+     * @param y       The given year.
+     * @pre           C::date_min <= date_t{y, 1, 1} && date_t{y, 1, 1} <= C::date_max
+     */
+    explicit constexpr
+    iterator(year_t y) noexcept : y_{y}, n_{C::to_rata_die(typename C::date_t{y, 1, 1})} {
+    }
+
+    /**
+     * @brief Returns the current year.
+     */
+    year_info_t constexpr
+    operator *() const noexcept {
+      return {y_, n_, length(y_)};
+    }
+
+    /**
+     * @brief Returns the year k years after the current one.
+     *
+     * @param k       The number of years.
+     */
+    year_info_t constexpr
+    operator [](difference_type k) const noexcept {
+      return *(*this + k);
+    }
+
+    /**
+     * @brief Moves to the next year.
+     */
+    iterator constexpr&
+    operator ++() noexcept {
+      n_ = rata_die_t(n_ + length(y_));
+      ++y_;
+      return *this;
+    }
+
+    /**
+     * @brief Moves to the previous year.
+     */
+    iterator constexpr&
+    operator --() noexcept {
+      --y_;
+      n_ = rata_die_t(n_ - length(y_));
+      return *this;
+    }
+
+    iterator constexpr
+    operator ++(int) noexcept {
+      auto const i = *this;
+      ++*this;
+      return i;
+    }
+
+    iterator constexpr
+    operator --(int) noexcept {
+      auto const i = *this;
+      --*this;
+      return i;
+    }
+
+    /**
+     * @brief Moves k years forward (through C::to_rata_die).
+     *
+     * @param k       The number of years.
+     */
+    iterator constexpr&
+    operator +=(difference_type k) noexcept {
+      return *this = iterator(year_t(y_ + k));
+    }
+
+    /**
+     * @brief Moves k years backward (through C::to_rata_die).
+     *
+     * @param k       The number of years.
+     */
+    iterator constexpr&
+    operator -=(difference_type k) noexcept {
+      return *this += -k;
+    }
+
+    friend iterator constexpr
+    operator +(iterator i, difference_type k) noexcept {
+      return i += k;
+    }
+
+    friend iterator constexpr
+    operator +(difference_type k, iterator i) noexcept {
+      return i += k;
+    }
+
+    friend iterator constexpr
+    operator -(iterator i, difference_type k) noexcept {
+      return i -= k;
+    }
+
+    friend difference_type constexpr
+    operator -(iterator const& i, iterator const& j) noexcept {
+      return difference_type(i.y_) - difference_type(j.y_);
+    }
+
+    friend bool constexpr
+    operator ==(iterator const& i, iterator const& j) noexcept {
+      return i.n_ == j.n_;
+    }
+
+    friend std::strong_ordering constexpr
+    operator <=>(iterator const& i, iterator const& j) noexcept {
+      return i.n_ <=> j.n_;
+    }
+
+  private:
+
+    /**
+     * @brief Returns the length of a given year.
+     *
+     * @param y       The given year.
+     */
+    rata_die_t static constexpr
+    length(year_t y) noexcept {
+      return 365 + is_leap_year(year_t(y % 400));
+    }
+
+    year_t     y_ = C::epoch.year;
+    rata_die_t n_ = C::to_rata_die(typename C::date_t{C::epoch.year, 1, 1});
+  }; // class iterator
+
+  /**
+   * @brief Creates an empty view.
+   */
+  years_view_t() = default;
+
+  /**
+   * @brief Creates a view of the years in [first, last).
+   *
+   * @param first     The first year.
+   * @param last      The year past the last one.
+   * @pre             C::date_min <= first && first <= last && last <= C::date_max (where first
+   *                  and last are the January 1st of the years)
+   */
+  constexpr
+  years_view_t(year_t first, year_t last) noexcept : first_{first}, last_{last} {
+  }
+
+  /**
+   * @brief Returns an iterator to the first year.
+   */
+  iterator constexpr
+  begin() const noexcept {
+    return first_;
+  }
+
+  /**
+   * @brief Returns an iterator past the last year.
+   */
+  iterator constexpr
+  end() const noexcept {
+    return last_;
+  }
+
+  /**
+   * @brief Returns the number of years.
+   */
+  std::size_t constexpr
+  size() const noexcept {
+    return std::size_t(last_ - first_);
+  }
+
+private:
+
+  iterator first_;
+  iterator last_;
+}; // class years_view_t
+
+namespace std::ranges {
+
+template <typename C>
+bool constexpr enable_borrowed_range<days_view_t<C>> = true;
+
+template <typename C>
+bool constexpr enable_borrowed_range<months_view_t<C>> = true;
+
+template <typename C>
+bool constexpr enable_borrowed_range<years_view_t<C>> = true;
+
+} // namespace std::ranges
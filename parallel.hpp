@@ -0,0 +1,406 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+ *
+ * This file is part of https://github.com/cassioneri/calendar.
+ *
+ * This file is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software  Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This file is distributed in the hope that it will be useful, but WITHOUT ANY  WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this file. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/**
+ * @file parallel.hpp
+ *
+ * @brief Multi-threaded batch calendar algorithms.
+ *
+ * Inputs are split into chunks small enough for inputs and outputs of a chunk to fit in the L2
+ * cache. Chunks are run on a work-stealing thread pool by the batch (SIMD) implementations of
+ * ugregorian_t or gregorian_t and results match the single-threaded ones bit for bit.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "calendar.hpp"
+
+/**
+ * @brief Default number of elements in a chunk.
+ */
+std::size_t constexpr parallel_chunk_size = 16384;
+
+/**
+ * @brief Work-stealing thread pool.
+ *
+ * Each call to run() initially distributes contiguous ranges of chunks evenly to workers (the
+ * calling thread included). Workers take chunks from the front of their own ranges and, when these
+ * are exhausted, steal chunks from the back of others' ranges. Hence, a worker preempted by the OS
+ * or slowed by its memory node does not delay the whole run.
+ */
+class thread_pool_t {
+
+public:
+
+  /**
+   * @brief Creates a pool with a given number of workers (including the calling thread).
+   *
+   * @param size      The given number of workers.
+   */
+  explicit
+  thread_pool_t(std::size_t size = std::thread::hardware_concurrency()) :
+    queues_(std::make_unique<queue_t[]>(std::max(size, std::size_t(1)))) {
+    for (std::size_t w = 1; w < std::max(size, std::size_t(1)); ++w)
+      threads_.emplace_back([this, w]() { loop(w); });
+  }
+
+  thread_pool_t(thread_pool_t const&) = delete;
+
+  thread_pool_t&
+  operator =(thread_pool_t const&) = delete;
+
+  /**
+   * @brief Stops and joins all threads.
+   */
+  ~thread_pool_t() {
+    {
+      std::lock_guard lock{mutex_};
+      stop_ = true;
+    }
+    start_.notify_all();
+    for (auto& thread : threads_)
+      thread.join();
+  }
+
+  /**
+   * @brief Returns the number of workers (including the calling thread).
+   */
+  std::size_t
+  size() const noexcept {
+    return threads_.size() + 1;
+  }
+
+  /**
+   * @brief Calls task(i) for all i in [0, chunks) and returns when all calls have returned.
+   *
+   * Calls are made by the calling thread and by the pool's threads. Concurrent calls to run() are
+   * serialised.
+   *
+   * @param chunks    The number of chunks.
+   * @param task      The task.
+   */
+  void
+  run(std::size_t chunks, std::function<void(std::size_t)> task) {
+
+    std::lock_guard run_lock{run_mutex_};
+
+    auto const n = size();
+    for (std::size_t w = 0; w < n; ++w) {
+      std::lock_guard lock{queues_[w].mutex};
+      queues_[w].begin = chunks * w / n;
+      queues_[w].end   = chunks * (w + 1) / n;
+    }
+
+    {
+      std::lock_guard lock{mutex_};
+      task_ = std::move(task);
+      busy_ = threads_.size();
+      ++generation_;
+    }
+    start_.notify_all();
+
+    work(0);
+
+    std::unique_lock lock{mutex_};
+    done_.wait(lock, [this]() { return busy_ == 0; });
+  }
+
+private:
+
+  /**
+   * @brief Range [begin, end) of chunks of a worker (aligned to avoid false sharing).
+   */
+  struct alignas(64) queue_t {
+    std::mutex  mutex;
+    std::size_t begin = 0;
+    std::size_t end   = 0;
+  };
+
+  /**
+   * @brief Takes a chunk from the front of the range of worker w.
+   *
+   * @param w         The worker.
+   * @param i         Output chunk.
+   */
+  bool
+  pop(std::size_t w, std::size_t& i) {
+    std::lock_guard lock{queues_[w].mutex};
+    if (queues_[w].begin == queues_[w].end)
+      return false;
+    i = queues_[w].begin++;
+    return true;
+  }
+
+  /**
+   * @brief Takes a chunk from the back of the range of any worker other than w.
+   *
+   * @param w         The stealing worker.
+   * @param i         Output chunk.
+   */
+  bool
+  steal(std::size_t w, std::size_t& i) {
+    auto const n = size();
+    for (std::size_t k = 1; k < n; ++k) {
+      auto& queue = queues_[(w + k) % n];
+      std::lock_guard lock{queue.mutex};
+      if (queue.begin != queue.end) {
+        i = --queue.end;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Runs chunks of the current task until none is left.
+   *
+   * @param w         The worker.
+   */
+  void
+  work(std::size_t w) {
+    std::size_t i;
+    while (pop(w, i) || steal(w, i))
+      task_(i);
+  }
+
+  /**
+   * @brief Main loop of pool's threads.
+   *
+   * @param w         The worker.
+   */
+  void
+  loop(std::size_t w) {
+
+    std::uint64_t generation = 0;
+
+    while (true) {
+
+      {
+        std::unique_lock lock{mutex_};
+        start_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+        if (stop_)
+          return;
+        generation = generation_;
+      }
+
+      work(w);
+
+      std::lock_guard lock{mutex_};
+      if (--busy_ == 0)
+        done_.notify_one();
+    }
+  }
+
+  std::unique_ptr<queue_t[]>        queues_;
+  std::vector<std::thread>          threads_;
+  std::function<void(std::size_t)>  task_;
+  std::mutex                        run_mutex_;
+  std::mutex                        mutex_;
+  std::condition_variable           start_;
+  std::condition_variable           done_;
+  std::uint64_t                     generation_ = 0;
+  std::size_t                       busy_       = 0;
+  bool                              stop_       = false;
+};
+
+/**
+ * @brief Calls f(first, last) for consecutive sub-ranges [first, last) of [0, size), each of at
+ * most chunk elements, on a given pool.
+ *
+ * @param pool        The given pool.
+ * @param size        The number of elements.
+ * @param chunk       The maximum number of elements in a sub-range.
+ * @param f           The function.
+ * @pre               chunk > 0
+ */
+template <typename F>
+void
+parallel_for(thread_pool_t& pool, std::size_t size, std::size_t chunk, F const& f) {
+  auto const chunks = (size + chunk - 1) / chunk;
+  pool.run(chunks, [&](std::size_t i) {
+    f(i * chunk, std::min(size, (i + 1) * chunk));
+  });
+}
+
+/**
+ * @brief Converts the given rata dies into dates on a given pool.
+ *
+ * Equivalent to C::to_date(r, y, m, d).
+ *
+ * @tparam C          The calendar (ugregorian_t or gregorian_t).
+ * @param pool        The given pool.
+ * @param r           The given rata dies.
+ * @param y           Output years.
+ * @param m           Output months.
+ * @param d           Output days.
+ * @param chunk       The number of elements in a chunk.
+ * @pre               C::rata_die_min <= r[i] && r[i] <= C::rata_die_max for all i
+ * @pre               r.size() <= y.size() && r.size() <= m.size() && r.size() <= d.size()
+ */
+template <typename C>
+void
+parallel_to_date(thread_pool_t& pool, std::span<typename C::rata_die_t const> r,
+  std::span<typename C::year_t> y, std::span<month_t> m,
+  std::span<day_t> d, std::size_t chunk = parallel_chunk_size) {
+  parallel_for(pool, r.size(), chunk, [&](std::size_t first, std::size_t last) {
+    auto const n = last - first;
+    C::to_date(r.subspan(first, n), y.subspan(first, n), m.subspan(first, n), d.subspan(first, n));
+  });
+}
+
+/**
+ * @brief Converts the given rata dies into dates stored in columns on a given pool.
+ *
+ * Equivalent to C::to_date(r, u).
+ *
+ * @tparam C          The calendar (ugregorian_t or gregorian_t).
+ * @param pool        The given pool.
+ * @param r           The given rata dies.
+ * @param u           Output dates.
+ * @param chunk       The number of elements in a chunk.
+ * @pre               C::rata_die_min <= r[i] && r[i] <= C::rata_die_max for all i
+ * @pre               r.size() <= u.size()
+ */
+template <typename C>
+void
+parallel_to_date(thread_pool_t& pool, std::span<typename C::rata_die_t const> r,
+  typename C::date_columns_t& u, std::size_t chunk = parallel_chunk_size) {
+  parallel_to_date<C>(pool, r, std::span{u.years}, std::span{u.months}, std::span{u.days}, chunk);
+}
+
+/**
+ * @brief Converts the contiguous range of rata dies [first, first + size) into dates stored in
+ * columns on a given pool.
+ *
+ * Rata dies of each chunk are generated in blocks on the stack and converted by C::to_date.
+ *
+ * @tparam C          The calendar (ugregorian_t or gregorian_t).
+ * @param pool        The given pool.
+ * @param first       The first rata die.
+ * @param size        The number of rata dies.
+ * @param u           Output dates.
+ * @param chunk       The number of elements in a chunk.
+ * @pre               C::rata_die_min <= first && first + (size - 1) <= C::rata_die_max
+ * @pre               size <= u.size()
+ */
+template <typename C>
+void
+parallel_to_date(thread_pool_t& pool, typename C::rata_die_t first, std::size_t size,
+  typename C::date_columns_t& u, std::size_t chunk = parallel_chunk_size) {
+
+  using rata_die_t = typename C::rata_die_t;
+
+  parallel_for(pool, size, chunk, [&](std::size_t begin, std::size_t end) {
+
+    rata_die_t r[1024];
+
+    for (auto i = begin; i < end; i += std::size(r)) {
+
+      auto const n = std::min(std::size(r), end - i);
+      for (std::size_t k = 0; k < n; ++k)
+        r[k] = rata_die_t(first + rata_die_t(i + k));
+
+      C::to_date(std::span<rata_die_t const>{r, n}, std::span{u.years}.subspan(i, n),
+        std::span{u.months}.subspan(i, n), std::span{u.days}.subspan(i, n));
+    }
+  });
+}
+
+/**
+ * @brief Converts the given dates into rata dies on a given pool.
+ *
+ * Equivalent to C::to_rata_die(u, r).
+ *
+ * @tparam C          The calendar (ugregorian_t or gregorian_t).
+ * @param pool        The given pool.
+ * @param u           The given dates.
+ * @param r           Output rata dies.
+ * @param chunk       The number of elements in a chunk.
+ * @pre               C::date_min <= u[i] && u[i] <= C::date_max for all i
+ * @pre               u.size() <= r.size()
+ */
+template <typename C>
+void
+parallel_to_rata_die(thread_pool_t& pool, std::span<typename C::date_t const> u,
+  std::span<typename C::rata_die_t> r, std::size_t chunk = parallel_chunk_size) {
+  parallel_for(pool, u.size(), chunk, [&](std::size_t first, std::size_t last) {
+    auto const n = last - first;
+    C::to_rata_die(u.subspan(first, n), r.subspan(first, n));
+  });
+}
+
+/**
+ * @brief Converts the given dates into rata dies on a given pool.
+ *
+ * Equivalent to C::to_rata_die(y, m, d, r).
+ *
+ * @tparam C          The calendar (ugregorian_t or gregorian_t).
+ * @param pool        The given pool.
+ * @param y           The given years.
+ * @param m           The given months.
+ * @param d           The given days.
+ * @param r           Output rata dies.
+ * @param chunk       The number of elements in a chunk.
+ * @pre               C::date_min <= (y[i], m[i], d[i]) && (y[i], m[i], d[i]) <= C::date_max for
+ *                    all i
+ * @pre               y.size() <= m.size() && y.size() <= d.size() && y.size() <= r.size()
+ */
+template <typename C>
+void
+parallel_to_rata_die(thread_pool_t& pool, std::span<typename C::year_t const> y,
+  std::span<month_t const> m, std::span<day_t const> d,
+  std::span<typename C::rata_die_t> r, std::size_t chunk = parallel_chunk_size) {
+  parallel_for(pool, y.size(), chunk, [&](std::size_t first, std::size_t last) {
+    auto const n = last - first;
+    C::to_rata_die(y.subspan(first, n), m.subspan(first, n), d.subspan(first, n),
+      r.subspan(first, n));
+  });
+}
+
+/**
+ * @brief Converts the given dates, stored in columns, into rata dies on a given pool.
+ *
+ * Equivalent to C::to_rata_die(u, r).
+ *
+ * @tparam C          The calendar (ugregorian_t or gregorian_t).
+ * @param pool        The given pool.
+ * @param u           The given dates.
+ * @param r           Output rata dies.
+ * @param chunk       The number of elements in a chunk.
+ * @pre               C::date_min <= u[i] && u[i] <= C::date_max for all i
+ * @pre               u.size() <= r.size()
+ */
+template <typename C>
+void
+parallel_to_rata_die(thread_pool_t& pool, typename C::date_columns_t const& u,
+  std::span<typename C::rata_die_t> r, std::size_t chunk = parallel_chunk_size) {
+  parallel_to_rata_die<C>(pool, std::span{u.years}, std::span{u.months}, std::span{u.days}, r,
+    chunk);
+}
@@ -0,0 +1,2342 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2020 Cassio Neri and Lorenz Schneider
+ *
+ * This file is part of https://github.com/cassioneri/calendar.
+ *
+ * This file is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software  Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This file is distributed in the hope that it will be useful, but WITHOUT ANY  WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this file. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/**
+ * @file simd.hpp
+ *
+ * @brief SIMD kernels for batch calendar algorithms.
+ *
+ * Kernels work on 32-bit unsigned lanes and implement the same EAF steps as their scalar
+ * counterparts in calendar.hpp. They process the longest prefix of the input whose size is a
+ * multiple of the number of lanes and return its size. Callers are responsible for the remaining
+ * elements.
+ *
+ * Kernels for each instruction set (SSE4.1, AVX2 and AVX-512) are compiled through target
+ * attributes regardless of compiler flags. Dispatchers select, at run time, the kernels of the best
+ * tier supported by the CPU.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace simd {
+
+#if defined(__x86_64__) || defined(__i386__)
+
+namespace sse41 {
+
+/**
+ * @brief   Number of 32-bit lanes.
+ */
+std::size_t constexpr lanes = 4;
+
+/**
+ * @brief   Returns the upper 32 bits of the 64-bit products of 32-bit unsigned lanes by a constant.
+ *
+ * @param   a         The vector of 32-bit lanes.
+ * @param   c         The constant.
+ */
+[[gnu::target("sse4.1")]] inline __m128i
+mulhi(__m128i a, std::uint32_t c) noexcept {
+  auto const b    = _mm_set1_epi32(int(c));
+  auto const even = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+  auto const odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+  return _mm_blend_epi16(even, odd, 0b11001100);
+}
+
+/**
+ * @brief   Stores the lower 16 or 32 bits of each 32-bit lane.
+ *
+ * @tparam  T         Type of stored elements.
+ * @param   p         Pointer to where lanes are stored.
+ * @param   a         The vector of 32-bit lanes.
+ */
+template <typename T>
+[[gnu::target("sse4.1")]] void
+store(T* p, __m128i a) noexcept {
+
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4);
+
+  if constexpr (sizeof(T) == 4)
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+
+  else {
+    auto const shuffle = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_shuffle_epi8(a, shuffle));
+  }
+}
+
+/**
+ * @brief   Stores the lower 8 bits of each 32-bit lane.
+ *
+ * @param   p         Pointer to where lanes are stored.
+ * @param   a         The vector of 32-bit lanes.
+ */
+[[gnu::target("sse4.1")]] inline void
+store(std::uint8_t* p, __m128i a) noexcept {
+  auto const shuffle = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+  _mm_storeu_si32(p, _mm_shuffle_epi8(a, shuffle));
+}
+
+/**
+ * @brief   Loads 16, 32 or 64-bit elements into 32-bit lanes (16-bit elements are sign or zero
+ *          extended as appropriate and 64-bit elements are truncated).
+ *
+ * @tparam  T         Type of loaded elements.
+ * @param   p         Pointer to where elements are loaded from.
+ */
+template <typename T>
+[[gnu::target("sse4.1")]] __m128i
+load(T const* p) noexcept {
+
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+  if constexpr (sizeof(T) == 8) {
+    auto const a = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)));
+    auto const b = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + 2)));
+    return _mm_castps_si128(_mm_shuffle_ps(a, b, 0b10001000));
+  }
+
+  else if constexpr (sizeof(T) == 4)
+    return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+
+  else {
+    auto const a = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(p));
+    return std::is_signed_v<T> ? _mm_cvtepi16_epi32(a) : _mm_cvtepu16_epi32(a);
+  }
+}
+
+/**
+ * @brief   Loads 8-bit unsigned elements into 32-bit lanes.
+ *
+ * @param   p         Pointer to where elements are loaded from.
+ */
+[[gnu::target("sse4.1")]] inline __m128i
+load(std::uint8_t const* p) noexcept {
+  return _mm_cvtepu8_epi32(_mm_loadu_si32(p));
+}
+
+/**
+ * @brief   Loads dates and deinterleaves their years, months and days into 32-bit lanes.
+ *
+ * This is the 4-lane version of avx2::load. For 8-byte layouts, shufps picks years and
+ * months/days from two registers.
+ *
+ * @tparam  D         Date storage type (a struct with members year, month and day, in this order).
+ * @param   p         Pointer to where dates are loaded from.
+ * @param   y         Output years.
+ * @param   m         Output months.
+ * @param   d         Output days.
+ */
+template <typename D>
+[[gnu::target("sse4.1")]] void
+load(D const* p, __m128i& y, __m128i& m, __m128i& d) noexcept {
+
+  using Y = decltype(D::year);
+
+  static_assert(sizeof(D) == 2 * sizeof(Y) && (sizeof(Y) == 2 || sizeof(Y) == 4));
+
+  auto const c255 = _mm_set1_epi32(255);
+
+  if constexpr (sizeof(Y) == 2) {
+    // Each lane is day << 24 | month << 16 | year.
+    auto const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+    y = std::is_signed_v<Y> ? _mm_srai_epi32(_mm_slli_epi32(a, 16), 16) :
+      _mm_srli_epi32(_mm_slli_epi32(a, 16), 16);
+    m = _mm_and_si128(_mm_srli_epi32(a, 16), c255);
+    d = _mm_srli_epi32(a, 24);
+  }
+
+  else {
+    // Each pair of lanes is (year, padding << 16 | day << 8 | month).
+    auto const a  = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)));
+    auto const b  = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + 2)));
+    auto const md = _mm_castps_si128(_mm_shuffle_ps(a, b, 0b11011101));
+    y = _mm_castps_si128(_mm_shuffle_ps(a, b, 0b10001000));
+    m = _mm_and_si128(md, c255);
+    d = _mm_and_si128(_mm_srli_epi32(md, 8), c255);
+  }
+}
+
+/**
+ * @brief   Converts dates into rata dies (see avx2::to_rata_die).
+ *
+ * @param   y1        The given years.
+ * @param   m1        The given months.
+ * @param   d1        The given days.
+ * @param   y_offset  Offset added to years before conversion (broadcast).
+ * @param   r_offset  Offset added to rata dies after conversion (broadcast).
+ */
+[[gnu::target("sse4.1")]] inline __m128i
+to_rata_die(__m128i y1, __m128i m1, __m128i d1, __m128i y_offset, __m128i r_offset) noexcept {
+
+  auto const c1    = _mm_set1_epi32(1);
+  auto const c3    = _mm_set1_epi32(3);
+  auto const c12   = _mm_set1_epi32(12);
+  auto const c979  = _mm_set1_epi32(979);
+  auto const c1461 = _mm_set1_epi32(1461);
+  auto const c2919 = _mm_set1_epi32(2919);
+
+  // j is either 0 or -1 (all bits set).
+  auto const j  = _mm_cmpgt_epi32(c3, m1);
+  auto const y0 = _mm_add_epi32(_mm_add_epi32(y1, y_offset), j);
+  auto const m0 = _mm_add_epi32(m1, _mm_and_si128(j, c12));
+  auto const d0 = _mm_sub_epi32(d1, c1);
+
+  // y0 / 100 == y0 * 1374389535 / 2^37 for all y0 < 2^32.
+  auto const q1 = _mm_srli_epi32(mulhi(y0, 1374389535), 5);
+  auto const yc = _mm_add_epi32(_mm_sub_epi32(_mm_srli_epi32(_mm_mullo_epi32(y0, c1461), 2), q1),
+    _mm_srli_epi32(q1, 2));
+  auto const mc = _mm_srli_epi32(_mm_sub_epi32(_mm_madd_epi16(m0, c979), c2919), 5);
+  auto const dc = d0;
+
+  return _mm_add_epi32(_mm_add_epi32(_mm_add_epi32(yc, mc), dc), r_offset);
+}
+
+/**
+ * @brief   Converts dates, given by columns, into rata dies (see avx2::to_rata_die).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y1        The given years.
+ * @param   m1        The given months.
+ * @param   d1        The given days.
+ * @param   size      Number of given dates.
+ * @param   y_offset  Offset added to years before conversion.
+ * @param   r_offset  Offset added to rata dies after conversion.
+ * @param   r1        Output rata dies.
+ */
+template <typename Y>
+[[gnu::target("sse4.1")]] std::size_t
+to_rata_die(Y const* y1, std::uint8_t const* m1, std::uint8_t const* d1, std::size_t size,
+  std::uint32_t y_offset, std::uint32_t r_offset, std::uint32_t* r1) noexcept {
+
+  auto const cy  = _mm_set1_epi32(int(y_offset));
+  auto const cr  = _mm_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    auto const r = to_rata_die(load(y1 + i), load(m1 + i), load(d1 + i), cy, cr);
+    store(r1 + i, r);
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts dates, given by an array of structs, into rata dies (see avx2::to_rata_die).
+ *
+ * @tparam  D         Date storage type (a struct with members year, month and day, in this order).
+ * @param   u1        The given dates.
+ * @param   size      Number of given dates.
+ * @param   y_offset  Offset added to years before conversion.
+ * @param   r_offset  Offset added to rata dies after conversion.
+ * @param   r1        Output rata dies.
+ */
+template <typename D>
+[[gnu::target("sse4.1")]] std::size_t
+to_rata_die(D const* u1, std::size_t size, std::uint32_t y_offset, std::uint32_t r_offset,
+  std::uint32_t* r1) noexcept {
+
+  auto const cy  = _mm_set1_epi32(int(y_offset));
+  auto const cr  = _mm_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __m128i y, m, d;
+    load(u1 + i, y, m, d);
+    store(r1 + i, to_rata_die(y, m, d, cy, cr));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts rata dies into dates (see avx2::to_date).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   y_offset  Offset added to years after conversion.
+ * @param   y1        Output years.
+ * @param   m1        Output months.
+ * @param   d1        Output days.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+template <typename Y>
+[[gnu::target("sse4.1")]] std::size_t
+to_date(std::uint32_t const* r0, std::size_t size, std::uint32_t r_offset, std::uint32_t y_offset,
+  Y* y1, std::uint8_t* m1, std::uint8_t* d1) noexcept {
+
+  auto const c1      = _mm_set1_epi32(1);
+  auto const c3      = _mm_set1_epi32(3);
+  auto const c12     = _mm_set1_epi32(12);
+  auto const c100    = _mm_set1_epi32(100);
+  auto const c305    = _mm_set1_epi32(305);
+  auto const c1461   = _mm_set1_epi32(1461);
+  auto const c2141   = _mm_set1_epi32(2141);
+  auto const c62690  = _mm_set1_epi32(62690);
+  auto const c65535  = _mm_set1_epi32(65535);
+  auto const c146097 = _mm_set1_epi32(146097);
+  auto const c197913 = _mm_set1_epi32(197913);
+  auto const cr      = _mm_set1_epi32(int(r_offset));
+  auto const cy      = _mm_set1_epi32(int(y_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+
+    auto const r  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(r0 + i));
+
+    auto const n1 = _mm_add_epi32(_mm_slli_epi32(_mm_add_epi32(r, cr), 2), c3);
+    auto const q1 = _mm_srli_epi32(mulhi(n1, 963315389), 15);
+    auto const r1 = _mm_srli_epi32(_mm_sub_epi32(n1, _mm_mullo_epi32(q1, c146097)), 2);
+
+    auto const n2 = _mm_or_si128(_mm_slli_epi32(r1, 2), c3);
+    auto const q2 = mulhi(n2, 2939745);
+    auto const r2 = _mm_srli_epi32(_mm_sub_epi32(n2, _mm_madd_epi16(q2, c1461)), 2);
+
+    auto const n3 = _mm_add_epi32(_mm_madd_epi16(r2, c2141), c197913);
+    auto const q3 = _mm_srli_epi32(n3, 16);
+    auto const r3 = _mm_srli_epi32(_mm_mulhi_epu16(_mm_and_si128(n3, c65535), c62690), 11);
+
+    auto const y0 = _mm_add_epi32(_mm_madd_epi16(q1, c100), q2);
+    auto const m0 = q3;
+    auto const d0 = r3;
+
+    // j is either 0 or -1 (all bits set).
+    auto const j  = _mm_cmpgt_epi32(r2, c305);
+    auto const y  = _mm_add_epi32(_mm_sub_epi32(y0, j), cy);
+    auto const m  = _mm_sub_epi32(m0, _mm_and_si128(j, c12));
+    auto const d  = _mm_add_epi32(d0, c1);
+
+    store(y1 + i, y);
+    store(m1 + i, m);
+    store(d1 + i, d);
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts rata dies into dates kept in registers (see to_date).
+ *
+ * @param   r0        The given rata dies.
+ * @param   y1        Output years.
+ * @param   m1        Output months.
+ * @param   d1        Output days.
+ * @pre               r0 <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("sse4.1")]] inline void
+to_date(__m128i r0, __m128i& y1, __m128i& m1, __m128i& d1) noexcept {
+
+  auto const c1      = _mm_set1_epi32(1);
+  auto const c3      = _mm_set1_epi32(3);
+  auto const c12     = _mm_set1_epi32(12);
+  auto const c100    = _mm_set1_epi32(100);
+  auto const c305    = _mm_set1_epi32(305);
+  auto const c1461   = _mm_set1_epi32(1461);
+  auto const c2141   = _mm_set1_epi32(2141);
+  auto const c62690  = _mm_set1_epi32(62690);
+  auto const c65535  = _mm_set1_epi32(65535);
+  auto const c146097 = _mm_set1_epi32(146097);
+  auto const c197913 = _mm_set1_epi32(197913);
+
+  auto const n1 = _mm_add_epi32(_mm_slli_epi32(r0, 2), c3);
+  auto const q1 = _mm_srli_epi32(mulhi(n1, 963315389), 15);
+  auto const r1 = _mm_srli_epi32(_mm_sub_epi32(n1, _mm_mullo_epi32(q1, c146097)), 2);
+
+  auto const n2 = _mm_or_si128(_mm_slli_epi32(r1, 2), c3);
+  auto const q2 = mulhi(n2, 2939745);
+  auto const r2 = _mm_srli_epi32(_mm_sub_epi32(n2, _mm_madd_epi16(q2, c1461)), 2);
+
+  auto const n3 = _mm_add_epi32(_mm_madd_epi16(r2, c2141), c197913);
+  auto const q3 = _mm_srli_epi32(n3, 16);
+  auto const r3 = _mm_srli_epi32(_mm_mulhi_epu16(_mm_and_si128(n3, c65535), c62690), 11);
+
+  auto const y0 = _mm_add_epi32(_mm_madd_epi16(q1, c100), q2);
+
+  // j is either 0 or -1 (all bits set).
+  auto const j  = _mm_cmpgt_epi32(r2, c305);
+  y1 = _mm_sub_epi32(y0, j);
+  m1 = _mm_sub_epi32(q3, _mm_and_si128(j, c12));
+  d1 = _mm_add_epi32(r3, c1);
+}
+
+/**
+ * @brief   Checks whether years are leap or not (see avx2::is_leap_year).
+ *
+ * @param   y         The given years.
+ * @return            Lanes set to -1 (all bits set) for leap years and to 0 otherwise.
+ */
+[[gnu::target("sse4.1")]] inline __m128i
+is_leap_year(__m128i y) noexcept {
+
+  auto const c0   = _mm_setzero_si128();
+  auto const c3   = _mm_set1_epi32(3);
+  auto const c12  = _mm_set1_epi32(12);
+  auto const sign = _mm_set1_epi32(int(0x80000000));
+
+  auto const bound      = _mm_set1_epi32(int(42949669 ^ 0x80000000));
+  auto const multiplier = _mm_set1_epi32(42949673);
+  auto const offset     = _mm_set1_epi32(536870800);
+
+  auto const sum  = _mm_add_epi32(y, offset);
+  auto const prod = _mm_xor_si128(_mm_mullo_epi32(sum, multiplier), sign);
+  auto const j    = _mm_cmpgt_epi32(bound, prod);
+  auto const mask = _mm_or_si128(_mm_and_si128(j, c12), c3);
+
+  return _mm_cmpeq_epi32(_mm_and_si128(sum, mask), c0);
+}
+
+/**
+ * @brief   Checks whether years are leap or not (see avx2::is_leap_year).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y         The given years.
+ * @param   size      Number of given years.
+ * @param   bits      Output bitmask.
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999
+ */
+template <typename Y>
+[[gnu::target("sse4.1")]] std::size_t
+is_leap_year(Y const* y, std::size_t size, std::uint64_t* bits) noexcept {
+
+  auto const end = size - size % 64;
+
+  for (std::size_t i = 0; i < end; i += 64) {
+    std::uint64_t word = 0;
+    for (std::size_t j = 0; j < 64; j += lanes) {
+      auto const leap = _mm_castsi128_ps(is_leap_year(load(y + i + j)));
+      word |= std::uint64_t(_mm_movemask_ps(leap)) << j;
+    }
+    bits[i / 64] = word;
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the last days of the months of given years and months (see
+ *          avx2::last_day_of_month).
+ *
+ * @param   y         The given years.
+ * @param   m         The given months.
+ */
+[[gnu::target("sse4.1")]] inline __m128i
+last_day_of_month(__m128i y, __m128i m) noexcept {
+
+  auto const c2  = _mm_set1_epi32(2);
+  auto const c28 = _mm_set1_epi32(28);
+  auto const c30 = _mm_set1_epi32(30);
+
+  auto const other    = _mm_or_si128(_mm_xor_si128(m, _mm_srli_epi32(m, 3)), c30);
+  auto const february = _mm_sub_epi32(c28, is_leap_year(y));
+
+  return _mm_blendv_epi8(other, february, _mm_cmpeq_epi32(m, c2));
+}
+
+/**
+ * @brief   Returns the last days of the months of given years and months (see
+ *          avx2::last_day_of_month).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y         The given years.
+ * @param   m         The given months.
+ * @param   size      Number of given years and months.
+ * @param   d         Output last days of months.
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999 && 1 <= m[i] && m[i] <= 12
+ */
+template <typename Y>
+[[gnu::target("sse4.1")]] std::size_t
+last_day_of_month(Y const* y, std::uint8_t const* m, std::size_t size, std::uint8_t* d) noexcept {
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes)
+    store(d + i, last_day_of_month(load(y + i), load(m + i)));
+
+  return end;
+}
+
+/**
+ * @brief   Returns the days of the week of given rata dies (see avx2::day_of_week).
+ *
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   r_offset  Offset added to rata dies before the remainder by 7 is taken.
+ * @param   w         Output days of the week.
+ * @pre               r0[i] + r_offset < 1431655766
+ */
+[[gnu::target("sse4.1")]] inline std::size_t
+day_of_week(std::uint32_t const* r0, std::size_t size, std::uint32_t r_offset, std::uint8_t* w)
+  noexcept {
+
+  auto const cr  = _mm_set1_epi32(int(r_offset));
+  auto const c   = _mm_set1_epi32(613566757);
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    auto const n = _mm_add_epi32(load(r0 + i), cr);
+    store(w + i, mulhi(_mm_mullo_epi32(n, c), 7));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Adds a number of months to rata dies (see avx2::add_months).
+ *
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   n         The number of months to add (two's complement for negative numbers).
+ * @param   r_offset  Offset added to rata dies before, and subtracted after, the addition.
+ * @param   ra        Output rata dies.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max and the result
+ *                    is in [ugregorian_t<std::uint32_t>::date_min,
+ *                    ugregorian_t<std::uint32_t>::date_max]
+ */
+[[gnu::target("sse4.1")]] inline std::size_t
+add_months(std::uint32_t const* r0, std::size_t size, std::uint32_t n, std::uint32_t r_offset,
+  std::uint32_t* ra) noexcept {
+
+  auto const c0  = _mm_setzero_si128();
+  auto const c1  = _mm_set1_epi32(1);
+  auto const cr  = _mm_set1_epi32(int(r_offset));
+  auto const cs  = _mm_set1_epi32(-int(r_offset));
+  auto const cn  = _mm_set1_epi32(int(n - 1));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+
+    __m128i y, m, d;
+    to_date(_mm_add_epi32(load(r0 + i), cr), y, m, d);
+
+    // 12 * y == 8 * y + 4 * y.
+    auto const k  = _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(y, 3), _mm_slli_epi32(y, 2)),
+      _mm_add_epi32(m, cn));
+    auto const ya = _mm_srli_epi32(mulhi(k, 2863311531), 3);
+    auto const ma = _mm_add_epi32(_mm_sub_epi32(k, _mm_add_epi32(_mm_slli_epi32(ya, 3),
+      _mm_slli_epi32(ya, 2))), c1);
+    auto const da = _mm_min_epu32(d, last_day_of_month(ya, ma));
+
+    store(ra + i, to_rata_die(ya, ma, da, c0, cs));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the magnitudes of the numbers of whole months between rata dies (see
+ *          avx2::months_between).
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   s         Output lanes set to -1 (all bits set) where r1 < r0 and to 0 otherwise.
+ * @pre               r0 <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1 <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("sse4.1")]] inline __m128i
+months_between(__m128i r0, __m128i r1, __m128i& s) noexcept {
+
+  // Rata dies are less than 2^31 and, hence, the signed comparison is correct.
+  s = _mm_cmpgt_epi32(r0, r1);
+
+  __m128i y0, m0, d0, y1, m1, d1;
+  to_date(_mm_min_epu32(r0, r1), y0, m0, d0);
+  to_date(_mm_max_epu32(r0, r1), y1, m1, d1);
+
+  // 12 * dy == 8 * dy + 4 * dy.
+  auto const dy = _mm_sub_epi32(y1, y0);
+  auto const k  = _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(dy, 3),
+    _mm_slli_epi32(dy, 2)), _mm_sub_epi32(m1, m0));
+
+  // e is either 0 or -1 (all bits set).
+  auto const e  = _mm_andnot_si128(_mm_cmpeq_epi32(d1, last_day_of_month(y1, m1)),
+    _mm_cmpgt_epi32(d0, d1));
+
+  return _mm_add_epi32(k, e);
+}
+
+/**
+ * @brief   Returns the numbers of whole months between rata dies (see avx2::months_between).
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   size      Number of given pairs of rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   k         Output numbers of months.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("sse4.1")]] inline std::size_t
+months_between(std::uint32_t const* r0, std::uint32_t const* r1, std::size_t size,
+  std::uint32_t r_offset, std::int32_t* k) noexcept {
+
+  auto const cr  = _mm_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __m128i s;
+    auto const a = months_between(_mm_add_epi32(load(r0 + i), cr),
+      _mm_add_epi32(load(r1 + i), cr), s);
+    store(k + i, _mm_sub_epi32(_mm_xor_si128(a, s), s));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the numbers of whole years between rata dies (see avx2::years_between).
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   size      Number of given pairs of rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   y         Output numbers of years.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("sse4.1")]] inline std::size_t
+years_between(std::uint32_t const* r0, std::uint32_t const* r1, std::size_t size,
+  std::uint32_t r_offset, std::int32_t* y) noexcept {
+
+  auto const cr  = _mm_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __m128i s;
+    auto const a = months_between(_mm_add_epi32(load(r0 + i), cr),
+      _mm_add_epi32(load(r1 + i), cr), s);
+    auto const q = _mm_srli_epi32(mulhi(a, 2863311531), 3);
+    store(y + i, _mm_sub_epi32(_mm_xor_si128(q, s), s));
+  }
+
+  return end;
+}
+
+} // namespace sse41
+
+namespace avx2 {
+
+/**
+ * @brief   Number of 32-bit lanes.
+ */
+std::size_t constexpr lanes = 8;
+
+/**
+ * @brief   Returns the upper 32 bits of the 64-bit products of 32-bit unsigned lanes by a constant.
+ *
+ * @param   a         The vector of 32-bit lanes.
+ * @param   c         The constant.
+ */
+[[gnu::target("avx2")]] inline __m256i
+mulhi(__m256i a, std::uint32_t c) noexcept {
+  auto const b    = _mm256_set1_epi32(int(c));
+  auto const even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  auto const odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  return _mm256_blend_epi32(even, odd, 0b10101010);
+}
+
+/**
+ * @brief   Stores the lower 16 or 32 bits of each 32-bit lane.
+ *
+ * @tparam  T         Type of stored elements.
+ * @param   p         Pointer to where lanes are stored.
+ * @param   a         The vector of 32-bit lanes.
+ */
+template <typename T>
+[[gnu::target("avx2")]] void
+store(T* p, __m256i a) noexcept {
+
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4);
+
+  if constexpr (sizeof(T) == 4)
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+
+  else {
+    auto const shuffle = _mm256_setr_epi8(
+      0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+      0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+    auto const packed  = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a, shuffle), 0b1000);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(packed));
+  }
+}
+
+/**
+ * @brief   Stores the lower 8 bits of each 32-bit lane.
+ *
+ * @param   p         Pointer to where lanes are stored.
+ * @param   a         The vector of 32-bit lanes.
+ */
+[[gnu::target("avx2")]] inline void
+store(std::uint8_t* p, __m256i a) noexcept {
+  auto const shuffle = _mm256_setr_epi8(
+    0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+  auto const permute = _mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1);
+  auto const packed  = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(a, shuffle), permute);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(packed));
+}
+
+/**
+ * @brief   Loads 16, 32 or 64-bit elements into 32-bit lanes (16-bit elements are sign or zero
+ *          extended as appropriate and 64-bit elements are truncated).
+ *
+ * @tparam  T         Type of loaded elements.
+ * @param   p         Pointer to where elements are loaded from.
+ */
+template <typename T>
+[[gnu::target("avx2")]] __m256i
+load(T const* p) noexcept {
+
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+  if constexpr (sizeof(T) == 8) {
+    auto const permute = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    auto const a  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+    auto const b  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + 4));
+    auto const pa = _mm256_permutevar8x32_epi32(a, permute);
+    auto const pb = _mm256_permutevar8x32_epi32(b, permute);
+    return _mm256_permute2x128_si256(pa, pb, 0x20);
+  }
+
+  else if constexpr (sizeof(T) == 4)
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+
+  else {
+    auto const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+    return std::is_signed_v<T> ? _mm256_cvtepi16_epi32(a) : _mm256_cvtepu16_epi32(a);
+  }
+}
+
+/**
+ * @brief   Loads 8-bit unsigned elements into 32-bit lanes.
+ *
+ * @param   p         Pointer to where elements are loaded from.
+ */
+[[gnu::target("avx2")]] inline __m256i
+load(std::uint8_t const* p) noexcept {
+  return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p)));
+}
+
+/**
+ * @brief   Loads dates and deinterleaves their years, months and days into 32-bit lanes.
+ *
+ * Layouts of 4 bytes (16-bit years) and 8 bytes (32-bit years and 2 bytes of padding) are
+ * supported. Years are sign or zero extended as appropriate. Padding is ignored.
+ *
+ * @tparam  D         Date storage type (a struct with members year, month and day, in this order).
+ * @param   p         Pointer to where dates are loaded from.
+ * @param   y         Output years.
+ * @param   m         Output months.
+ * @param   d         Output days.
+ */
+template <typename D>
+[[gnu::target("avx2")]] void
+load(D const* p, __m256i& y, __m256i& m, __m256i& d) noexcept {
+
+  using Y = decltype(D::year);
+
+  static_assert(sizeof(D) == 2 * sizeof(Y) && (sizeof(Y) == 2 || sizeof(Y) == 4));
+
+  auto const c255 = _mm256_set1_epi32(255);
+
+  if constexpr (sizeof(Y) == 2) {
+    // Each lane is day << 24 | month << 16 | year.
+    auto const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+    y = std::is_signed_v<Y> ? _mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16) :
+      _mm256_srli_epi32(_mm256_slli_epi32(a, 16), 16);
+    m = _mm256_and_si256(_mm256_srli_epi32(a, 16), c255);
+    d = _mm256_srli_epi32(a, 24);
+  }
+
+  else {
+    // Each pair of lanes is (year, padding << 16 | day << 8 | month).
+    auto const permute = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    auto const a  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+    auto const b  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + 4));
+    auto const pa = _mm256_permutevar8x32_epi32(a, permute);
+    auto const pb = _mm256_permutevar8x32_epi32(b, permute);
+    auto const md = _mm256_permute2x128_si256(pa, pb, 0x31);
+    y = _mm256_permute2x128_si256(pa, pb, 0x20);
+    m = _mm256_and_si256(md, c255);
+    d = _mm256_and_si256(_mm256_srli_epi32(md, 8), c255);
+  }
+}
+
+/**
+ * @brief   Converts dates into rata dies (see ugregorian_t::to_rata_die).
+ *
+ * Lanes compute ugregorian_t<std::uint32_t>::to_rata_die({y1 + y_offset, m1, d1}) + r_offset.
+ *
+ * The division by 100 is replaced by a multiplication which is exact for all 32-bit unsigned
+ * dividends. Like ugregorian_t::to_rata_die, calculations are performed modulo 2^32.
+ *
+ * @param   y1        The given years.
+ * @param   m1        The given months.
+ * @param   d1        The given days.
+ * @param   y_offset  Offset added to years before conversion (broadcast).
+ * @param   r_offset  Offset added to rata dies after conversion (broadcast).
+ */
+[[gnu::target("avx2")]] inline __m256i
+to_rata_die(__m256i y1, __m256i m1, __m256i d1, __m256i y_offset, __m256i r_offset) noexcept {
+
+  auto const c1    = _mm256_set1_epi32(1);
+  auto const c3    = _mm256_set1_epi32(3);
+  auto const c12   = _mm256_set1_epi32(12);
+  auto const c979  = _mm256_set1_epi32(979);
+  auto const c1461 = _mm256_set1_epi32(1461);
+  auto const c2919 = _mm256_set1_epi32(2919);
+
+  // j is either 0 or -1 (all bits set).
+  auto const j  = _mm256_cmpgt_epi32(c3, m1);
+  auto const y0 = _mm256_add_epi32(_mm256_add_epi32(y1, y_offset), j);
+  auto const m0 = _mm256_add_epi32(m1, _mm256_and_si256(j, c12));
+  auto const d0 = _mm256_sub_epi32(d1, c1);
+
+  // y0 / 100 == y0 * 1374389535 / 2^37 for all y0 < 2^32.
+  auto const q1 = _mm256_srli_epi32(mulhi(y0, 1374389535), 5);
+  auto const yc = _mm256_add_epi32(_mm256_sub_epi32(
+    _mm256_srli_epi32(_mm256_mullo_epi32(y0, c1461), 2), q1), _mm256_srli_epi32(q1, 2));
+  auto const mc = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_madd_epi16(m0, c979), c2919), 5);
+  auto const dc = d0;
+
+  return _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(yc, mc), dc), r_offset);
+}
+
+/**
+ * @brief   Converts dates, given by columns of years, months and days, into rata dies.
+ *
+ * Lanes compute ugregorian_t<std::uint32_t>::to_rata_die({y1[i] + y_offset, m1[i], d1[i]}) +
+ * r_offset, where y1[i] is sign or zero extended to 32 bits as appropriate.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y1        The given years.
+ * @param   m1        The given months.
+ * @param   d1        The given days.
+ * @param   size      Number of given dates.
+ * @param   y_offset  Offset added to years before conversion.
+ * @param   r_offset  Offset added to rata dies after conversion.
+ * @param   r1        Output rata dies.
+ */
+template <typename Y>
+[[gnu::target("avx2")]] std::size_t
+to_rata_die(Y const* y1, std::uint8_t const* m1, std::uint8_t const* d1, std::size_t size,
+  std::uint32_t y_offset, std::uint32_t r_offset, std::uint32_t* r1) noexcept {
+
+  auto const cy  = _mm256_set1_epi32(int(y_offset));
+  auto const cr  = _mm256_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    auto const r = to_rata_die(load(y1 + i), load(m1 + i), load(d1 + i), cy, cr);
+    store(r1 + i, r);
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts dates, given by an array of structs, into rata dies.
+ *
+ * Lanes compute ugregorian_t<std::uint32_t>::to_rata_die({u1[i].year + y_offset, u1[i].month,
+ * u1[i].day}) + r_offset, where u1[i].year is sign or zero extended to 32 bits as appropriate.
+ *
+ * @tparam  D         Date storage type (a struct with members year, month and day, in this order).
+ * @param   u1        The given dates.
+ * @param   size      Number of given dates.
+ * @param   y_offset  Offset added to years before conversion.
+ * @param   r_offset  Offset added to rata dies after conversion.
+ * @param   r1        Output rata dies.
+ */
+template <typename D>
+[[gnu::target("avx2")]] std::size_t
+to_rata_die(D const* u1, std::size_t size, std::uint32_t y_offset, std::uint32_t r_offset,
+  std::uint32_t* r1) noexcept {
+
+  auto const cy  = _mm256_set1_epi32(int(y_offset));
+  auto const cr  = _mm256_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __m256i y, m, d;
+    load(u1 + i, y, m, d);
+    store(r1 + i, to_rata_die(y, m, d, cy, cr));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts rata dies into dates (see ugregorian_t::to_date).
+ *
+ * Lanes compute ugregorian_t<std::uint32_t>::to_date(r0[i] + r_offset) and years are shifted by
+ * y_offset and truncated to Y.
+ *
+ * Divisions by 146097 and 2141 are replaced by multiplications. Their coefficients, found by
+ * exhaustive search, are exact on the domain of ugregorian_t::to_date. Remainders are obtained by
+ * subtracting the product of quotient and divisor.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   y_offset  Offset added to years after conversion.
+ * @param   y1        Output years.
+ * @param   m1        Output months.
+ * @param   d1        Output days.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+template <typename Y>
+[[gnu::target("avx2")]] std::size_t
+to_date(std::uint32_t const* r0, std::size_t size, std::uint32_t r_offset, std::uint32_t y_offset,
+  Y* y1, std::uint8_t* m1, std::uint8_t* d1) noexcept {
+
+  auto const c1      = _mm256_set1_epi32(1);
+  auto const c3      = _mm256_set1_epi32(3);
+  auto const c12     = _mm256_set1_epi32(12);
+  auto const c100    = _mm256_set1_epi32(100);
+  auto const c305    = _mm256_set1_epi32(305);
+  auto const c1461   = _mm256_set1_epi32(1461);
+  auto const c2141   = _mm256_set1_epi32(2141);
+  auto const c62690  = _mm256_set1_epi32(62690);
+  auto const c65535  = _mm256_set1_epi32(65535);
+  auto const c146097 = _mm256_set1_epi32(146097);
+  auto const c197913 = _mm256_set1_epi32(197913);
+  auto const cr      = _mm256_set1_epi32(int(r_offset));
+  auto const cy      = _mm256_set1_epi32(int(y_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+
+    auto const r  = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(r0 + i));
+
+    // n1 / 146097 == n1 * 963315389 / 2^47 since n1 = 4 * r0 + 3 < 2^32.
+    auto const n1 = _mm256_add_epi32(_mm256_slli_epi32(_mm256_add_epi32(r, cr), 2), c3);
+    auto const q1 = _mm256_srli_epi32(mulhi(n1, 963315389), 15);
+    auto const r1 = _mm256_srli_epi32(_mm256_sub_epi32(n1, _mm256_mullo_epi32(q1, c146097)), 2);
+
+    // q2 and r2 are as in ugregorian_t::to_date since u2 % p32 / 2939745 == n2 % 1461.
+    auto const n2 = _mm256_or_si256(_mm256_slli_epi32(r1, 2), c3);
+    auto const q2 = mulhi(n2, 2939745);
+    auto const r2 = _mm256_srli_epi32(_mm256_sub_epi32(n2, _mm256_madd_epi16(q2, c1461)), 2);
+
+    // n3 % p16 / 2141 == n3 % p16 * 62690 / 2^27 for all r2 in [0, 365].
+    auto const n3 = _mm256_add_epi32(_mm256_madd_epi16(r2, c2141), c197913);
+    auto const q3 = _mm256_srli_epi32(n3, 16);
+    auto const r3 = _mm256_srli_epi32(_mm256_mulhi_epu16(_mm256_and_si256(n3, c65535), c62690),
+      11);
+
+    auto const y0 = _mm256_add_epi32(_mm256_madd_epi16(q1, c100), q2);
+    auto const m0 = q3;
+    auto const d0 = r3;
+
+    // j is either 0 or -1 (all bits set).
+    auto const j  = _mm256_cmpgt_epi32(r2, c305);
+    auto const y  = _mm256_add_epi32(_mm256_sub_epi32(y0, j), cy);
+    auto const m  = _mm256_sub_epi32(m0, _mm256_and_si256(j, c12));
+    auto const d  = _mm256_add_epi32(d0, c1);
+
+    store(y1 + i, y);
+    store(m1 + i, m);
+    store(d1 + i, d);
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts rata dies into dates kept in registers (see to_date).
+ *
+ * @param   r0        The given rata dies.
+ * @param   y1        Output years.
+ * @param   m1        Output months.
+ * @param   d1        Output days.
+ * @pre               r0 <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("avx2")]] inline void
+to_date(__m256i r0, __m256i& y1, __m256i& m1, __m256i& d1) noexcept {
+
+  auto const c1      = _mm256_set1_epi32(1);
+  auto const c3      = _mm256_set1_epi32(3);
+  auto const c12     = _mm256_set1_epi32(12);
+  auto const c100    = _mm256_set1_epi32(100);
+  auto const c305    = _mm256_set1_epi32(305);
+  auto const c1461   = _mm256_set1_epi32(1461);
+  auto const c2141   = _mm256_set1_epi32(2141);
+  auto const c62690  = _mm256_set1_epi32(62690);
+  auto const c65535  = _mm256_set1_epi32(65535);
+  auto const c146097 = _mm256_set1_epi32(146097);
+  auto const c197913 = _mm256_set1_epi32(197913);
+
+  auto const n1 = _mm256_add_epi32(_mm256_slli_epi32(r0, 2), c3);
+  auto const q1 = _mm256_srli_epi32(mulhi(n1, 963315389), 15);
+  auto const r1 = _mm256_srli_epi32(_mm256_sub_epi32(n1, _mm256_mullo_epi32(q1, c146097)), 2);
+
+  auto const n2 = _mm256_or_si256(_mm256_slli_epi32(r1, 2), c3);
+  auto const q2 = mulhi(n2, 2939745);
+  auto const r2 = _mm256_srli_epi32(_mm256_sub_epi32(n2, _mm256_madd_epi16(q2, c1461)), 2);
+
+  auto const n3 = _mm256_add_epi32(_mm256_madd_epi16(r2, c2141), c197913);
+  auto const q3 = _mm256_srli_epi32(n3, 16);
+  auto const r3 = _mm256_srli_epi32(_mm256_mulhi_epu16(_mm256_and_si256(n3, c65535), c62690), 11);
+
+  auto const y0 = _mm256_add_epi32(_mm256_madd_epi16(q1, c100), q2);
+
+  // j is either 0 or -1 (all bits set).
+  auto const j  = _mm256_cmpgt_epi32(r2, c305);
+  y1 = _mm256_sub_epi32(y0, j);
+  m1 = _mm256_sub_epi32(q3, _mm256_and_si256(j, c12));
+  d1 = _mm256_add_epi32(r3, c1);
+}
+
+/**
+ * @brief   Checks whether years are leap or not (see is_leap_year in calendar.hpp).
+ *
+ * Lanes perform the mcomp test for multiples of 100 followed by Drepper's twist. Since AVX2 lacks
+ * unsigned comparisons, the mcomp test flips the sign bits of both sides and uses the signed one.
+ *
+ * @param   y         The given years.
+ * @return            Lanes set to -1 (all bits set) for leap years and to 0 otherwise.
+ */
+[[gnu::target("avx2")]] inline __m256i
+is_leap_year(__m256i y) noexcept {
+
+  auto const c0   = _mm256_setzero_si256();
+  auto const c3   = _mm256_set1_epi32(3);
+  auto const c12  = _mm256_set1_epi32(12);
+  auto const sign = _mm256_set1_epi32(int(0x80000000));
+
+  auto const bound      = _mm256_set1_epi32(int(42949669 ^ 0x80000000));
+  auto const multiplier = _mm256_set1_epi32(42949673);
+  auto const offset     = _mm256_set1_epi32(536870800);
+
+  // offset % 16 == 0 and hence, sum % 16 == y % 16.
+  auto const sum  = _mm256_add_epi32(y, offset);
+  auto const prod = _mm256_xor_si256(_mm256_mullo_epi32(sum, multiplier), sign);
+  auto const j    = _mm256_cmpgt_epi32(bound, prod);
+  auto const mask = _mm256_or_si256(_mm256_and_si256(j, c12), c3);
+
+  return _mm256_cmpeq_epi32(_mm256_and_si256(sum, mask), c0);
+}
+
+/**
+ * @brief   Checks whether years are leap or not (see is_leap_year in calendar.hpp).
+ *
+ * Bit i % 64 of bits[i / 64] is set if, and only if, y[i] is leap. Blocks of 64 years are
+ * processed at a time and each produces one word of bits.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y         The given years.
+ * @param   size      Number of given years.
+ * @param   bits      Output bitmask.
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999
+ */
+template <typename Y>
+[[gnu::target("avx2")]] std::size_t
+is_leap_year(Y const* y, std::size_t size, std::uint64_t* bits) noexcept {
+
+  auto const end = size - size % 64;
+
+  for (std::size_t i = 0; i < end; i += 64) {
+    std::uint64_t word = 0;
+    for (std::size_t j = 0; j < 64; j += lanes) {
+      auto const leap = _mm256_castsi256_ps(is_leap_year(load(y + i + j)));
+      word |= std::uint64_t(_mm256_movemask_ps(leap)) << j;
+    }
+    bits[i / 64] = word;
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the last days of the months of given years and months (see last_day_of_month
+ *          in calendar.hpp).
+ *
+ * Lanes evaluate both (m ^ (m >> 3)) | 30 and 28 + is_leap_year(y) and blend on m == 2.
+ *
+ * @param   y         The given years.
+ * @param   m         The given months.
+ */
+[[gnu::target("avx2")]] inline __m256i
+last_day_of_month(__m256i y, __m256i m) noexcept {
+
+  auto const c2  = _mm256_set1_epi32(2);
+  auto const c28 = _mm256_set1_epi32(28);
+  auto const c30 = _mm256_set1_epi32(30);
+
+  auto const other    = _mm256_or_si256(_mm256_xor_si256(m, _mm256_srli_epi32(m, 3)), c30);
+  // is_leap_year returns -1 for leap years.
+  auto const february = _mm256_sub_epi32(c28, is_leap_year(y));
+
+  return _mm256_blendv_epi8(other, february, _mm256_cmpeq_epi32(m, c2));
+}
+
+/**
+ * @brief   Returns the last days of the months of given years and months (see last_day_of_month
+ *          in calendar.hpp).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y         The given years.
+ * @param   m         The given months.
+ * @param   size      Number of given years and months.
+ * @param   d         Output last days of months.
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999 && 1 <= m[i] && m[i] <= 12
+ */
+template <typename Y>
+[[gnu::target("avx2")]] std::size_t
+last_day_of_month(Y const* y, std::uint8_t const* m, std::size_t size, std::uint8_t* d) noexcept {
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes)
+    store(d + i, last_day_of_month(load(y + i), load(m + i)));
+
+  return end;
+}
+
+/**
+ * @brief   Returns the days of the week of given rata dies (see ugregorian_t::day_of_week).
+ *
+ * For n = r0[i] + r_offset, the result is n % 7 == 7 * (613566757 * n % 2^32) / 2^32. This takes
+ * one vpmulld, which yields 613566757 * n % 2^32, and one multiply-high.
+ *
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   r_offset  Offset added to rata dies before the remainder by 7 is taken.
+ * @param   w         Output days of the week.
+ * @pre               r0[i] + r_offset < 1431655766
+ */
+[[gnu::target("avx2")]] inline std::size_t
+day_of_week(std::uint32_t const* r0, std::size_t size, std::uint32_t r_offset, std::uint8_t* w)
+  noexcept {
+
+  auto const cr  = _mm256_set1_epi32(int(r_offset));
+  auto const c   = _mm256_set1_epi32(613566757);
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    auto const n = _mm256_add_epi32(load(r0 + i), cr);
+    store(w + i, mulhi(_mm256_mullo_epi32(n, c), 7));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Adds a number of months to rata dies (see ugregorian_t::add_months).
+ *
+ * Lanes compute ugregorian_t<std::uint32_t>::add_months(r0[i] + r_offset, n) - r_offset. Rata dies
+ * are converted into dates as in to_date and k = 12 * y + m - 1 + n months since 0000-Jan are
+ * split back into year and month by the EAF k / 12 == k * 2863311531 / 2^35, which is exact for
+ * all k < 2^32. Days are clamped to last_day_of_month and dates are converted into rata dies as in
+ * to_rata_die. There are no loops over months and no branches.
+ *
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   n         The number of months to add (two's complement for negative numbers).
+ * @param   r_offset  Offset added to rata dies before, and subtracted after, the addition.
+ * @param   ra        Output rata dies.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max and the result
+ *                    is in [ugregorian_t<std::uint32_t>::date_min,
+ *                    ugregorian_t<std::uint32_t>::date_max]
+ */
+[[gnu::target("avx2")]] inline std::size_t
+add_months(std::uint32_t const* r0, std::size_t size, std::uint32_t n, std::uint32_t r_offset,
+  std::uint32_t* ra) noexcept {
+
+  auto const c0  = _mm256_setzero_si256();
+  auto const c1  = _mm256_set1_epi32(1);
+  auto const cr  = _mm256_set1_epi32(int(r_offset));
+  auto const cs  = _mm256_set1_epi32(-int(r_offset));
+  auto const cn  = _mm256_set1_epi32(int(n - 1));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+
+    __m256i y, m, d;
+    to_date(_mm256_add_epi32(load(r0 + i), cr), y, m, d);
+
+    // 12 * y == 8 * y + 4 * y.
+    auto const k  = _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(y, 3),
+      _mm256_slli_epi32(y, 2)), _mm256_add_epi32(m, cn));
+    auto const ya = _mm256_srli_epi32(mulhi(k, 2863311531), 3);
+    auto const ma = _mm256_add_epi32(_mm256_sub_epi32(k,
+      _mm256_add_epi32(_mm256_slli_epi32(ya, 3), _mm256_slli_epi32(ya, 2))), c1);
+    auto const da = _mm256_min_epu32(d, last_day_of_month(ya, ma));
+
+    store(ra + i, to_rata_die(ya, ma, da, c0, cs));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the magnitudes of the numbers of whole months between rata dies (see
+ *          ugregorian_t::months_between).
+ *
+ * Lanes order the rata dies, convert them into dates and compute 12 * (y1 - y0) + m1 - m0 minus
+ * one when the later day is smaller than the earlier and is not the last of its month. The result
+ * is the magnitude and the sign is returned separately.
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   s         Output lanes set to -1 (all bits set) where r1 < r0 and to 0 otherwise.
+ * @pre               r0 <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1 <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("avx2")]] inline __m256i
+months_between(__m256i r0, __m256i r1, __m256i& s) noexcept {
+
+  // Rata dies are less than 2^31 and, hence, the signed comparison is correct.
+  s = _mm256_cmpgt_epi32(r0, r1);
+
+  __m256i y0, m0, d0, y1, m1, d1;
+  to_date(_mm256_min_epu32(r0, r1), y0, m0, d0);
+  to_date(_mm256_max_epu32(r0, r1), y1, m1, d1);
+
+  // 12 * dy == 8 * dy + 4 * dy.
+  auto const dy = _mm256_sub_epi32(y1, y0);
+  auto const k  = _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(dy, 3),
+    _mm256_slli_epi32(dy, 2)), _mm256_sub_epi32(m1, m0));
+
+  // e is either 0 or -1 (all bits set).
+  auto const e  = _mm256_andnot_si256(_mm256_cmpeq_epi32(d1, last_day_of_month(y1, m1)),
+    _mm256_cmpgt_epi32(d0, d1));
+
+  return _mm256_add_epi32(k, e);
+}
+
+/**
+ * @brief   Returns the numbers of whole months between rata dies (see
+ *          ugregorian_t::months_between).
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   size      Number of given pairs of rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   k         Output numbers of months.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("avx2")]] inline std::size_t
+months_between(std::uint32_t const* r0, std::uint32_t const* r1, std::size_t size,
+  std::uint32_t r_offset, std::int32_t* k) noexcept {
+
+  auto const cr  = _mm256_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __m256i s;
+    auto const a = months_between(_mm256_add_epi32(load(r0 + i), cr),
+      _mm256_add_epi32(load(r1 + i), cr), s);
+    store(k + i, _mm256_sub_epi32(_mm256_xor_si256(a, s), s));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the numbers of whole years between rata dies (see
+ *          ugregorian_t::years_between).
+ *
+ * The magnitude of the number of months is divided by 12 using the EAF
+ * k / 12 == k * 2863311531 / 2^35 and the sign is restored afterwards.
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   size      Number of given pairs of rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   y         Output numbers of years.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("avx2")]] inline std::size_t
+years_between(std::uint32_t const* r0, std::uint32_t const* r1, std::size_t size,
+  std::uint32_t r_offset, std::int32_t* y) noexcept {
+
+  auto const cr  = _mm256_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __m256i s;
+    auto const a = months_between(_mm256_add_epi32(load(r0 + i), cr),
+      _mm256_add_epi32(load(r1 + i), cr), s);
+    auto const q = _mm256_srli_epi32(mulhi(a, 2863311531), 3);
+    store(y + i, _mm256_sub_epi32(_mm256_xor_si256(q, s), s));
+  }
+
+  return end;
+}
+
+} // namespace avx2
+
+namespace avx512 {
+
+/**
+ * @brief   Number of 32-bit lanes.
+ */
+std::size_t constexpr lanes = 16;
+
+/**
+ * @brief   Returns the upper 32 bits of the 64-bit products of 32-bit unsigned lanes by a constant.
+ *
+ * vpmuludq multiplies the even lanes. The odd lanes are shifted down to be multiplied and their
+ * products already have the upper halves in place. Hence, a mask blend (rather than a shuffle)
+ * merges the results.
+ *
+ * @param   a         The vector of 32-bit lanes.
+ * @param   c         The constant.
+ */
+[[gnu::target("avx512f,avx512bw")]] inline __m512i
+mulhi(__m512i a, std::uint32_t c) noexcept {
+  auto const b    = _mm512_set1_epi32(int(c));
+  auto const even = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+  auto const odd  = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), b);
+  return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+
+/**
+ * @brief   Stores the lower 16 or 32 bits of each 32-bit lane.
+ *
+ * @tparam  T         Type of stored elements.
+ * @param   p         Pointer to where lanes are stored.
+ * @param   a         The vector of 32-bit lanes.
+ */
+template <typename T>
+[[gnu::target("avx512f,avx512bw")]] void
+store(T* p, __m512i a) noexcept {
+
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4);
+
+  if constexpr (sizeof(T) == 4)
+    _mm512_storeu_si512(p, a);
+  else
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi32_epi16(a));
+}
+
+/**
+ * @brief   Stores the lower 8 bits of each 32-bit lane.
+ *
+ * @param   p         Pointer to where lanes are stored.
+ * @param   a         The vector of 32-bit lanes.
+ */
+[[gnu::target("avx512f,avx512bw")]] inline void
+store(std::uint8_t* p, __m512i a) noexcept {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm512_cvtepi32_epi8(a));
+}
+
+/**
+ * @brief   Loads 16, 32 or 64-bit elements into 32-bit lanes (16-bit elements are sign or zero
+ *          extended as appropriate and 64-bit elements are truncated).
+ *
+ * @tparam  T         Type of loaded elements.
+ * @param   p         Pointer to where elements are loaded from.
+ */
+template <typename T>
+[[gnu::target("avx512f,avx512bw")]] __m512i
+load(T const* p) noexcept {
+
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+  if constexpr (sizeof(T) == 8) {
+    auto const a = _mm512_cvtepi64_epi32(_mm512_loadu_si512(p));
+    auto const b = _mm512_cvtepi64_epi32(_mm512_loadu_si512(p + 8));
+    return _mm512_inserti64x4(_mm512_castsi256_si512(a), b, 1);
+  }
+
+  else if constexpr (sizeof(T) == 4)
+    return _mm512_loadu_si512(p);
+
+  else {
+    auto const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+    return std::is_signed_v<T> ? _mm512_cvtepi16_epi32(a) : _mm512_cvtepu16_epi32(a);
+  }
+}
+
+/**
+ * @brief   Loads 8-bit unsigned elements into 32-bit lanes.
+ *
+ * @param   p         Pointer to where elements are loaded from.
+ */
+[[gnu::target("avx512f,avx512bw")]] inline __m512i
+load(std::uint8_t const* p) noexcept {
+  return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)));
+}
+
+/**
+ * @brief   Loads dates and deinterleaves their years, months and days into 32-bit lanes.
+ *
+ * This is the 16-lane version of avx2::load. For 8-byte layouts, vpermt2d picks years and
+ * months/days from two registers in a single instruction each.
+ *
+ * @tparam  D         Date storage type (a struct with members year, month and day, in this order).
+ * @param   p         Pointer to where dates are loaded from.
+ * @param   y         Output years.
+ * @param   m         Output months.
+ * @param   d         Output days.
+ */
+template <typename D>
+[[gnu::target("avx512f,avx512bw")]] void
+load(D const* p, __m512i& y, __m512i& m, __m512i& d) noexcept {
+
+  using Y = decltype(D::year);
+
+  static_assert(sizeof(D) == 2 * sizeof(Y) && (sizeof(Y) == 2 || sizeof(Y) == 4));
+
+  auto const c255 = _mm512_set1_epi32(255);
+
+  if constexpr (sizeof(Y) == 2) {
+    // Each lane is day << 24 | month << 16 | year.
+    auto const a = _mm512_loadu_si512(p);
+    y = std::is_signed_v<Y> ? _mm512_srai_epi32(_mm512_slli_epi32(a, 16), 16) :
+      _mm512_srli_epi32(_mm512_slli_epi32(a, 16), 16);
+    m = _mm512_and_si512(_mm512_srli_epi32(a, 16), c255);
+    d = _mm512_srli_epi32(a, 24);
+  }
+
+  else {
+    // Each pair of lanes is (year, padding << 16 | day << 8 | month).
+    auto const even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28,
+      30);
+    auto const odd  = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29,
+      31);
+    auto const a    = _mm512_loadu_si512(p);
+    auto const b    = _mm512_loadu_si512(p + 8);
+    auto const md   = _mm512_permutex2var_epi32(a, odd, b);
+    y = _mm512_permutex2var_epi32(a, even, b);
+    m = _mm512_and_si512(md, c255);
+    d = _mm512_and_si512(_mm512_srli_epi32(md, 8), c255);
+  }
+}
+
+/**
+ * @brief   Converts dates into rata dies (see avx2::to_rata_die).
+ *
+ * @param   y1        The given years.
+ * @param   m1        The given months.
+ * @param   d1        The given days.
+ * @param   y_offset  Offset added to years before conversion (broadcast).
+ * @param   r_offset  Offset added to rata dies after conversion (broadcast).
+ */
+[[gnu::target("avx512f,avx512bw")]] inline __m512i
+to_rata_die(__m512i y1, __m512i m1, __m512i d1, __m512i y_offset, __m512i r_offset) noexcept {
+
+  auto const c1    = _mm512_set1_epi32(1);
+  auto const c3    = _mm512_set1_epi32(3);
+  auto const c12   = _mm512_set1_epi32(12);
+  auto const c979  = _mm512_set1_epi32(979);
+  auto const c1461 = _mm512_set1_epi32(1461);
+  auto const c2919 = _mm512_set1_epi32(2919);
+
+  auto const j  = _mm512_cmplt_epu32_mask(m1, c3);
+  auto const yj = _mm512_add_epi32(y1, y_offset);
+  auto const y0 = _mm512_mask_sub_epi32(yj, j, yj, c1);
+  auto const m0 = _mm512_mask_add_epi32(m1, j, m1, c12);
+  auto const d0 = _mm512_sub_epi32(d1, c1);
+
+  // y0 / 100 == y0 * 1374389535 / 2^37 for all y0 < 2^32.
+  auto const q1 = _mm512_srli_epi32(mulhi(y0, 1374389535), 5);
+  auto const yc = _mm512_add_epi32(_mm512_sub_epi32(
+    _mm512_srli_epi32(_mm512_mullo_epi32(y0, c1461), 2), q1), _mm512_srli_epi32(q1, 2));
+  auto const mc = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_madd_epi16(m0, c979), c2919), 5);
+  auto const dc = d0;
+
+  return _mm512_add_epi32(_mm512_add_epi32(_mm512_add_epi32(yc, mc), dc), r_offset);
+}
+
+/**
+ * @brief   Converts dates, given by columns, into rata dies (see avx2::to_rata_die).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y1        The given years.
+ * @param   m1        The given months.
+ * @param   d1        The given days.
+ * @param   size      Number of given dates.
+ * @param   y_offset  Offset added to years before conversion.
+ * @param   r_offset  Offset added to rata dies after conversion.
+ * @param   r1        Output rata dies.
+ */
+template <typename Y>
+[[gnu::target("avx512f,avx512bw")]] std::size_t
+to_rata_die(Y const* y1, std::uint8_t const* m1, std::uint8_t const* d1, std::size_t size,
+  std::uint32_t y_offset, std::uint32_t r_offset, std::uint32_t* r1) noexcept {
+
+  auto const cy  = _mm512_set1_epi32(int(y_offset));
+  auto const cr  = _mm512_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    auto const r = to_rata_die(load(y1 + i), load(m1 + i), load(d1 + i), cy, cr);
+    store(r1 + i, r);
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts dates, given by an array of structs, into rata dies (see avx2::to_rata_die).
+ *
+ * @tparam  D         Date storage type (a struct with members year, month and day, in this order).
+ * @param   u1        The given dates.
+ * @param   size      Number of given dates.
+ * @param   y_offset  Offset added to years before conversion.
+ * @param   r_offset  Offset added to rata dies after conversion.
+ * @param   r1        Output rata dies.
+ */
+template <typename D>
+[[gnu::target("avx512f,avx512bw")]] std::size_t
+to_rata_die(D const* u1, std::size_t size, std::uint32_t y_offset, std::uint32_t r_offset,
+  std::uint32_t* r1) noexcept {
+
+  auto const cy  = _mm512_set1_epi32(int(y_offset));
+  auto const cr  = _mm512_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __m512i y, m, d;
+    load(u1 + i, y, m, d);
+    store(r1 + i, to_rata_die(y, m, d, cy, cr));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts rata dies into dates (see ugregorian_t::to_date).
+ *
+ * This is the 16-lane version of avx2::to_date. Comparisons yield masks which drive masked
+ * additions and subtractions, and narrowing stores use vpmovdw and vpmovdb.
+ *
+ * IFMA (vpmadd52huq) was considered for the multiply-highs. However, it only sees 52 bits of each
+ * 64-bit lane and, thus, also needs even and odd lanes to be split and merged. Measurements showed
+ * no gain over vpmuludq.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   y_offset  Offset added to years after conversion.
+ * @param   y1        Output years.
+ * @param   m1        Output months.
+ * @param   d1        Output days.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+template <typename Y>
+[[gnu::target("avx512f,avx512bw")]] std::size_t
+to_date(std::uint32_t const* r0, std::size_t size, std::uint32_t r_offset, std::uint32_t y_offset,
+  Y* y1, std::uint8_t* m1, std::uint8_t* d1) noexcept {
+
+  auto const c1      = _mm512_set1_epi32(1);
+  auto const c3      = _mm512_set1_epi32(3);
+  auto const c12     = _mm512_set1_epi32(12);
+  auto const c100    = _mm512_set1_epi32(100);
+  auto const c305    = _mm512_set1_epi32(305);
+  auto const c1461   = _mm512_set1_epi32(1461);
+  auto const c2141   = _mm512_set1_epi32(2141);
+  auto const c62690  = _mm512_set1_epi32(62690);
+  auto const c65535  = _mm512_set1_epi32(65535);
+  auto const c146097 = _mm512_set1_epi32(146097);
+  auto const c197913 = _mm512_set1_epi32(197913);
+  auto const cr      = _mm512_set1_epi32(int(r_offset));
+  auto const cy      = _mm512_set1_epi32(int(y_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+
+    auto const r  = _mm512_loadu_si512(r0 + i);
+
+    // n1 / 146097 == n1 * 963315389 / 2^47 since n1 = 4 * r0 + 3 < 2^32.
+    auto const n1 = _mm512_add_epi32(_mm512_slli_epi32(_mm512_add_epi32(r, cr), 2), c3);
+    auto const q1 = _mm512_srli_epi32(mulhi(n1, 963315389), 15);
+    auto const r1 = _mm512_srli_epi32(_mm512_sub_epi32(n1, _mm512_mullo_epi32(q1, c146097)), 2);
+
+    // q2 and r2 are as in ugregorian_t::to_date since u2 % p32 / 2939745 == n2 % 1461.
+    auto const n2 = _mm512_or_si512(_mm512_slli_epi32(r1, 2), c3);
+    auto const q2 = mulhi(n2, 2939745);
+    auto const r2 = _mm512_srli_epi32(_mm512_sub_epi32(n2, _mm512_madd_epi16(q2, c1461)), 2);
+
+    // n3 % p16 / 2141 == n3 % p16 * 62690 / 2^27 for all r2 in [0, 365].
+    auto const n3 = _mm512_add_epi32(_mm512_madd_epi16(r2, c2141), c197913);
+    auto const q3 = _mm512_srli_epi32(n3, 16);
+    auto const r3 = _mm512_srli_epi32(_mm512_mulhi_epu16(_mm512_and_si512(n3, c65535), c62690),
+      11);
+
+    auto const y0 = _mm512_add_epi32(_mm512_madd_epi16(q1, c100), q2);
+    auto const m0 = q3;
+    auto const d0 = r3;
+
+    auto const j  = _mm512_cmpgt_epu32_mask(r2, c305);
+    auto const y  = _mm512_add_epi32(_mm512_mask_add_epi32(y0, j, y0, c1), cy);
+    auto const m  = _mm512_mask_sub_epi32(m0, j, m0, c12);
+    auto const d  = _mm512_add_epi32(d0, c1);
+
+    store(y1 + i, y);
+    store(m1 + i, m);
+    store(d1 + i, d);
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Converts rata dies into dates kept in registers (see to_date).
+ *
+ * @param   r0        The given rata dies.
+ * @param   y1        Output years.
+ * @param   m1        Output months.
+ * @param   d1        Output days.
+ * @pre               r0 <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("avx512f,avx512bw")]] inline void
+to_date(__m512i r0, __m512i& y1, __m512i& m1, __m512i& d1) noexcept {
+
+  auto const c1      = _mm512_set1_epi32(1);
+  auto const c3      = _mm512_set1_epi32(3);
+  auto const c12     = _mm512_set1_epi32(12);
+  auto const c100    = _mm512_set1_epi32(100);
+  auto const c305    = _mm512_set1_epi32(305);
+  auto const c1461   = _mm512_set1_epi32(1461);
+  auto const c2141   = _mm512_set1_epi32(2141);
+  auto const c62690  = _mm512_set1_epi32(62690);
+  auto const c65535  = _mm512_set1_epi32(65535);
+  auto const c146097 = _mm512_set1_epi32(146097);
+  auto const c197913 = _mm512_set1_epi32(197913);
+
+  auto const n1 = _mm512_add_epi32(_mm512_slli_epi32(r0, 2), c3);
+  auto const q1 = _mm512_srli_epi32(mulhi(n1, 963315389), 15);
+  auto const r1 = _mm512_srli_epi32(_mm512_sub_epi32(n1, _mm512_mullo_epi32(q1, c146097)), 2);
+
+  auto const n2 = _mm512_or_si512(_mm512_slli_epi32(r1, 2), c3);
+  auto const q2 = mulhi(n2, 2939745);
+  auto const r2 = _mm512_srli_epi32(_mm512_sub_epi32(n2, _mm512_madd_epi16(q2, c1461)), 2);
+
+  auto const n3 = _mm512_add_epi32(_mm512_madd_epi16(r2, c2141), c197913);
+  auto const q3 = _mm512_srli_epi32(n3, 16);
+  auto const r3 = _mm512_srli_epi32(_mm512_mulhi_epu16(_mm512_and_si512(n3, c65535), c62690), 11);
+
+  auto const y0 = _mm512_add_epi32(_mm512_madd_epi16(q1, c100), q2);
+
+  auto const j  = _mm512_cmpgt_epu32_mask(r2, c305);
+  y1 = _mm512_mask_add_epi32(y0, j, y0, c1);
+  m1 = _mm512_mask_sub_epi32(q3, j, q3, c12);
+  d1 = _mm512_add_epi32(r3, c1);
+}
+
+/**
+ * @brief   Checks whether years are leap or not (see avx2::is_leap_year).
+ *
+ * @param   y         The given years.
+ * @return            Bitmask whose bit i is set if, and only if, lane i holds a leap year.
+ */
+[[gnu::target("avx512f,avx512bw")]] inline __mmask16
+is_leap_year(__m512i y) noexcept {
+
+  auto const c3         = _mm512_set1_epi32(3);
+  auto const c15        = _mm512_set1_epi32(15);
+  auto const bound      = _mm512_set1_epi32(42949669);
+  auto const multiplier = _mm512_set1_epi32(42949673);
+  auto const offset     = _mm512_set1_epi32(536870800);
+
+  auto const sum  = _mm512_add_epi32(y, offset);
+  auto const j    = _mm512_cmplt_epu32_mask(_mm512_mullo_epi32(sum, multiplier), bound);
+  auto const mask = _mm512_mask_blend_epi32(j, c3, c15);
+
+  return _mm512_testn_epi32_mask(sum, mask);
+}
+
+/**
+ * @brief   Checks whether years are leap or not (see avx2::is_leap_year).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y         The given years.
+ * @param   size      Number of given years.
+ * @param   bits      Output bitmask.
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999
+ */
+template <typename Y>
+[[gnu::target("avx512f,avx512bw")]] std::size_t
+is_leap_year(Y const* y, std::size_t size, std::uint64_t* bits) noexcept {
+
+  auto const end = size - size % 64;
+
+  for (std::size_t i = 0; i < end; i += 64) {
+    std::uint64_t word = 0;
+    for (std::size_t j = 0; j < 64; j += lanes)
+      word |= std::uint64_t(is_leap_year(load(y + i + j))) << j;
+    bits[i / 64] = word;
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the last days of the months of given years and months (see
+ *          avx2::last_day_of_month).
+ *
+ * @param   y         The given years.
+ * @param   m         The given months.
+ */
+[[gnu::target("avx512f,avx512bw")]] inline __m512i
+last_day_of_month(__m512i y, __m512i m) noexcept {
+
+  auto const c1  = _mm512_set1_epi32(1);
+  auto const c2  = _mm512_set1_epi32(2);
+  auto const c28 = _mm512_set1_epi32(28);
+  auto const c30 = _mm512_set1_epi32(30);
+
+  auto const other    = _mm512_or_si512(_mm512_xor_si512(m, _mm512_srli_epi32(m, 3)), c30);
+  auto const february = _mm512_mask_add_epi32(c28, is_leap_year(y), c28, c1);
+
+  return _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(m, c2), other, february);
+}
+
+/**
+ * @brief   Returns the last days of the months of given years and months (see
+ *          avx2::last_day_of_month).
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y         The given years.
+ * @param   m         The given months.
+ * @param   size      Number of given years and months.
+ * @param   d         Output last days of months.
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999 && 1 <= m[i] && m[i] <= 12
+ */
+template <typename Y>
+[[gnu::target("avx512f,avx512bw")]] std::size_t
+last_day_of_month(Y const* y, std::uint8_t const* m, std::size_t size, std::uint8_t* d) noexcept {
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes)
+    store(d + i, last_day_of_month(load(y + i), load(m + i)));
+
+  return end;
+}
+
+/**
+ * @brief   Returns the days of the week of given rata dies (see avx2::day_of_week).
+ *
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   r_offset  Offset added to rata dies before the remainder by 7 is taken.
+ * @param   w         Output days of the week.
+ * @pre               r0[i] + r_offset < 1431655766
+ */
+[[gnu::target("avx512f,avx512bw")]] inline std::size_t
+day_of_week(std::uint32_t const* r0, std::size_t size, std::uint32_t r_offset, std::uint8_t* w)
+  noexcept {
+
+  auto const cr  = _mm512_set1_epi32(int(r_offset));
+  auto const c   = _mm512_set1_epi32(613566757);
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    auto const n = _mm512_add_epi32(load(r0 + i), cr);
+    store(w + i, mulhi(_mm512_mullo_epi32(n, c), 7));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Adds a number of months to rata dies (see avx2::add_months).
+ *
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   n         The number of months to add (two's complement for negative numbers).
+ * @param   r_offset  Offset added to rata dies before, and subtracted after, the addition.
+ * @param   ra        Output rata dies.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max and the result
+ *                    is in [ugregorian_t<std::uint32_t>::date_min,
+ *                    ugregorian_t<std::uint32_t>::date_max]
+ */
+[[gnu::target("avx512f,avx512bw")]] inline std::size_t
+add_months(std::uint32_t const* r0, std::size_t size, std::uint32_t n, std::uint32_t r_offset,
+  std::uint32_t* ra) noexcept {
+
+  auto const c0  = _mm512_setzero_si512();
+  auto const c1  = _mm512_set1_epi32(1);
+  auto const c12 = _mm512_set1_epi32(12);
+  auto const cr  = _mm512_set1_epi32(int(r_offset));
+  auto const cs  = _mm512_set1_epi32(-int(r_offset));
+  auto const cn  = _mm512_set1_epi32(int(n - 1));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+
+    __m512i y, m, d;
+    to_date(_mm512_add_epi32(load(r0 + i), cr), y, m, d);
+
+    auto const k  = _mm512_add_epi32(_mm512_mullo_epi32(y, c12), _mm512_add_epi32(m, cn));
+    auto const ya = _mm512_srli_epi32(mulhi(k, 2863311531), 3);
+    auto const ma = _mm512_add_epi32(_mm512_sub_epi32(k, _mm512_mullo_epi32(ya, c12)), c1);
+    auto const da = _mm512_min_epu32(d, last_day_of_month(ya, ma));
+
+    store(ra + i, to_rata_die(ya, ma, da, c0, cs));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the magnitudes of the numbers of whole months between rata dies (see
+ *          avx2::months_between).
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   s         Output bitmask whose bit i is set if, and only if, r1 < r0 in lane i.
+ * @pre               r0 <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1 <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("avx512f,avx512bw")]] inline __m512i
+months_between(__m512i r0, __m512i r1, __mmask16& s) noexcept {
+
+  auto const c1  = _mm512_set1_epi32(1);
+  auto const c12 = _mm512_set1_epi32(12);
+
+  s = _mm512_cmpgt_epu32_mask(r0, r1);
+
+  __m512i y0, m0, d0, y1, m1, d1;
+  to_date(_mm512_min_epu32(r0, r1), y0, m0, d0);
+  to_date(_mm512_max_epu32(r0, r1), y1, m1, d1);
+
+  auto const k  = _mm512_add_epi32(_mm512_mullo_epi32(_mm512_sub_epi32(y1, y0), c12),
+    _mm512_sub_epi32(m1, m0));
+  auto const e  = _mm512_mask_cmpgt_epu32_mask(_mm512_cmpneq_epi32_mask(d1,
+    last_day_of_month(y1, m1)), d0, d1);
+
+  return _mm512_mask_sub_epi32(k, e, k, c1);
+}
+
+/**
+ * @brief   Returns the numbers of whole months between rata dies (see avx2::months_between).
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   size      Number of given pairs of rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   k         Output numbers of months.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("avx512f,avx512bw")]] inline std::size_t
+months_between(std::uint32_t const* r0, std::uint32_t const* r1, std::size_t size,
+  std::uint32_t r_offset, std::int32_t* k) noexcept {
+
+  auto const c0  = _mm512_setzero_si512();
+  auto const cr  = _mm512_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __mmask16 s;
+    auto const a = months_between(_mm512_add_epi32(load(r0 + i), cr),
+      _mm512_add_epi32(load(r1 + i), cr), s);
+    store(k + i, _mm512_mask_sub_epi32(a, s, c0, a));
+  }
+
+  return end;
+}
+
+/**
+ * @brief   Returns the numbers of whole years between rata dies (see avx2::years_between).
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   size      Number of given pairs of rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   y         Output numbers of years.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+[[gnu::target("avx512f,avx512bw")]] inline std::size_t
+years_between(std::uint32_t const* r0, std::uint32_t const* r1, std::size_t size,
+  std::uint32_t r_offset, std::int32_t* y) noexcept {
+
+  auto const c0  = _mm512_setzero_si512();
+  auto const cr  = _mm512_set1_epi32(int(r_offset));
+
+  auto const end = size - size % lanes;
+
+  for (std::size_t i = 0; i < end; i += lanes) {
+    __mmask16 s;
+    auto const a = months_between(_mm512_add_epi32(load(r0 + i), cr),
+      _mm512_add_epi32(load(r1 + i), cr), s);
+    auto const q = _mm512_srli_epi32(mulhi(a, 2863311531), 3);
+    store(y + i, _mm512_mask_sub_epi32(q, s, c0, q));
+  }
+
+  return end;
+}
+
+} // namespace avx512
+
+#endif // defined(__x86_64__) || defined(__i386__)
+
+namespace scalar {
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+template <typename Y>
+std::size_t
+to_date(std::uint32_t const*, std::size_t, std::uint32_t, std::uint32_t, Y*, std::uint8_t*,
+  std::uint8_t*) noexcept {
+  return 0;
+}
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+template <typename Y>
+std::size_t
+to_rata_die(Y const*, std::uint8_t const*, std::uint8_t const*, std::size_t, std::uint32_t,
+  std::uint32_t, std::uint32_t*) noexcept {
+  return 0;
+}
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+template <typename D>
+std::size_t
+to_rata_die(D const*, std::size_t, std::uint32_t, std::uint32_t, std::uint32_t*) noexcept {
+  return 0;
+}
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+template <typename Y>
+std::size_t
+is_leap_year(Y const*, std::size_t, std::uint64_t*) noexcept {
+  return 0;
+}
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+template <typename Y>
+std::size_t
+last_day_of_month(Y const*, std::uint8_t const*, std::size_t, std::uint8_t*) noexcept {
+  return 0;
+}
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+inline std::size_t
+day_of_week(std::uint32_t const*, std::size_t, std::uint32_t, std::uint8_t*) noexcept {
+  return 0;
+}
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+inline std::size_t
+add_months(std::uint32_t const*, std::size_t, std::uint32_t, std::uint32_t, std::uint32_t*)
+  noexcept {
+  return 0;
+}
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+inline std::size_t
+months_between(std::uint32_t const*, std::uint32_t const*, std::size_t, std::uint32_t,
+  std::int32_t*) noexcept {
+  return 0;
+}
+
+/**
+ * @brief   Fallback kernel which processes no element (callers handle the whole input).
+ */
+inline std::size_t
+years_between(std::uint32_t const*, std::uint32_t const*, std::size_t, std::uint32_t,
+  std::int32_t*) noexcept {
+  return 0;
+}
+
+} // namespace scalar
+
+/**
+ * @brief   Instruction set tiers, in increasing order of capability.
+ */
+enum class tier_t : std::uint8_t {
+  scalar,
+  sse41,
+  avx2,
+  avx512,
+};
+
+/**
+ * @brief   Returns the highest tier supported by the running CPU.
+ *
+ * Detection relies on cpuid (through __builtin_cpu_supports) and not on compiler flags. Hence, a
+ * binary built for a baseline x86-64 target uses AVX-512 kernels on CPUs which support it.
+ */
+inline tier_t
+detected_tier() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return tier_t::avx512;
+  if (__builtin_cpu_supports("avx2"))
+    return tier_t::avx2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return tier_t::sse41;
+#endif
+  return tier_t::scalar;
+}
+
+namespace detail {
+
+/**
+ * @brief   Tier used by dispatchers. Initialised to detected_tier() at start-up.
+ */
+inline std::atomic<tier_t> active_tier = detected_tier();
+
+} // namespace detail
+
+/**
+ * @brief   Returns the tier used by dispatchers.
+ */
+inline tier_t
+active_tier() noexcept {
+  return detail::active_tier.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Sets the tier used by dispatchers (e.g., to test or benchmark lower tiers).
+ *
+ * @param   tier      The requested tier.
+ * @return            false, and no change is made, if tier is not supported by the running CPU.
+ */
+inline bool
+set_tier(tier_t tier) noexcept {
+  if (tier > detected_tier())
+    return false;
+  detail::active_tier.store(tier, std::memory_order_relaxed);
+  return true;
+}
+
+/**
+ * @brief   Converts rata dies into dates using the kernel of the active tier.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   y_offset  Offset added to years after conversion.
+ * @param   y1        Output years.
+ * @param   m1        Output months.
+ * @param   d1        Output days.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+template <typename Y>
+std::size_t
+to_date(std::uint32_t const* r0, std::size_t size, std::uint32_t r_offset, std::uint32_t y_offset,
+  Y* y1, std::uint8_t* m1, std::uint8_t* d1) noexcept {
+
+  using kernel_t = std::size_t (*)(std::uint32_t const*, std::size_t, std::uint32_t,
+    std::uint32_t, Y*, std::uint8_t*, std::uint8_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::to_date<Y>,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::to_date<Y>,
+    avx2::to_date<Y>,
+    avx512::to_date<Y>,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](r0, size, r_offset, y_offset, y1, m1, d1);
+}
+
+/**
+ * @brief   Converts dates, given by columns, into rata dies using the kernel of the active tier.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y1        The given years.
+ * @param   m1        The given months.
+ * @param   d1        The given days.
+ * @param   size      Number of given dates.
+ * @param   y_offset  Offset added to years before conversion.
+ * @param   r_offset  Offset added to rata dies after conversion.
+ * @param   r1        Output rata dies.
+ */
+template <typename Y>
+std::size_t
+to_rata_die(Y const* y1, std::uint8_t const* m1, std::uint8_t const* d1, std::size_t size,
+  std::uint32_t y_offset, std::uint32_t r_offset, std::uint32_t* r1) noexcept {
+
+  using kernel_t = std::size_t (*)(Y const*, std::uint8_t const*, std::uint8_t const*,
+    std::size_t, std::uint32_t, std::uint32_t, std::uint32_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::to_rata_die<Y>,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::to_rata_die<Y>,
+    avx2::to_rata_die<Y>,
+    avx512::to_rata_die<Y>,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](y1, m1, d1, size, y_offset, r_offset, r1);
+}
+
+/**
+ * @brief   Converts dates, given by an array of structs, into rata dies using the kernel of the
+ *          active tier.
+ *
+ * @tparam  D         Date storage type (a struct with members year, month and day, in this order).
+ * @param   u1        The given dates.
+ * @param   size      Number of given dates.
+ * @param   y_offset  Offset added to years before conversion.
+ * @param   r_offset  Offset added to rata dies after conversion.
+ * @param   r1        Output rata dies.
+ */
+template <typename D>
+std::size_t
+to_rata_die(D const* u1, std::size_t size, std::uint32_t y_offset, std::uint32_t r_offset,
+  std::uint32_t* r1) noexcept {
+
+  using kernel_t = std::size_t (*)(D const*, std::size_t, std::uint32_t, std::uint32_t,
+    std::uint32_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::to_rata_die<D>,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::to_rata_die<D>,
+    avx2::to_rata_die<D>,
+    avx512::to_rata_die<D>,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](u1, size, y_offset, r_offset, r1);
+}
+
+/**
+ * @brief   Checks whether years are leap or not using the kernel of the active tier.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y         The given years.
+ * @param   size      Number of given years.
+ * @param   bits      Output bitmask.
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999
+ */
+template <typename Y>
+std::size_t
+is_leap_year(Y const* y, std::size_t size, std::uint64_t* bits) noexcept {
+
+  using kernel_t = std::size_t (*)(Y const*, std::size_t, std::uint64_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::is_leap_year<Y>,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::is_leap_year<Y>,
+    avx2::is_leap_year<Y>,
+    avx512::is_leap_year<Y>,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](y, size, bits);
+}
+
+/**
+ * @brief   Returns the last days of the months of given years and months using the kernel of the
+ *          active tier.
+ *
+ * @tparam  Y         Year storage type.
+ * @param   y         The given years.
+ * @param   m         The given months.
+ * @param   size      Number of given years and months.
+ * @param   d         Output last days of months.
+ * @pre               -536870800 <= y[i] && y[i] <= 536870999 && 1 <= m[i] && m[i] <= 12
+ */
+template <typename Y>
+std::size_t
+last_day_of_month(Y const* y, std::uint8_t const* m, std::size_t size, std::uint8_t* d) noexcept {
+
+  using kernel_t = std::size_t (*)(Y const*, std::uint8_t const*, std::size_t,
+    std::uint8_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::last_day_of_month<Y>,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::last_day_of_month<Y>,
+    avx2::last_day_of_month<Y>,
+    avx512::last_day_of_month<Y>,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](y, m, size, d);
+}
+
+/**
+ * @brief   Returns the days of the week of given rata dies using the kernel of the active tier.
+ *
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   r_offset  Offset added to rata dies before the remainder by 7 is taken.
+ * @param   w         Output days of the week.
+ * @pre               r0[i] + r_offset < 1431655766
+ */
+inline std::size_t
+day_of_week(std::uint32_t const* r0, std::size_t size, std::uint32_t r_offset, std::uint8_t* w)
+  noexcept {
+
+  using kernel_t = std::size_t (*)(std::uint32_t const*, std::size_t, std::uint32_t,
+    std::uint8_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::day_of_week,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::day_of_week,
+    avx2::day_of_week,
+    avx512::day_of_week,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](r0, size, r_offset, w);
+}
+
+/**
+ * @brief   Adds a number of months to rata dies using the kernel of the active tier.
+ *
+ * @param   r0        The given rata dies.
+ * @param   size      Number of given rata dies.
+ * @param   n         The number of months to add (two's complement for negative numbers).
+ * @param   r_offset  Offset added to rata dies before, and subtracted after, the addition.
+ * @param   ra        Output rata dies.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max and the result
+ *                    is in [ugregorian_t<std::uint32_t>::date_min,
+ *                    ugregorian_t<std::uint32_t>::date_max]
+ */
+inline std::size_t
+add_months(std::uint32_t const* r0, std::size_t size, std::uint32_t n, std::uint32_t r_offset,
+  std::uint32_t* ra) noexcept {
+
+  using kernel_t = std::size_t (*)(std::uint32_t const*, std::size_t, std::uint32_t,
+    std::uint32_t, std::uint32_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::add_months,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::add_months,
+    avx2::add_months,
+    avx512::add_months,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](r0, size, n, r_offset, ra);
+}
+
+/**
+ * @brief   Returns the numbers of whole months between rata dies using the kernel of the active
+ *          tier.
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   size      Number of given pairs of rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   k         Output numbers of months.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+inline std::size_t
+months_between(std::uint32_t const* r0, std::uint32_t const* r1, std::size_t size,
+  std::uint32_t r_offset, std::int32_t* k) noexcept {
+
+  using kernel_t = std::size_t (*)(std::uint32_t const*, std::uint32_t const*, std::size_t,
+    std::uint32_t, std::int32_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::months_between,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::months_between,
+    avx2::months_between,
+    avx512::months_between,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](r0, r1, size, r_offset, k);
+}
+
+/**
+ * @brief   Returns the numbers of whole years between rata dies using the kernel of the active
+ *          tier.
+ *
+ * @param   r0        The given first rata dies.
+ * @param   r1        The given second rata dies.
+ * @param   size      Number of given pairs of rata dies.
+ * @param   r_offset  Offset added to rata dies before conversion.
+ * @param   y         Output numbers of years.
+ * @pre               r0[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max &&
+ *                    r1[i] + r_offset <= ugregorian_t<std::uint32_t>::rata_die_max
+ */
+inline std::size_t
+years_between(std::uint32_t const* r0, std::uint32_t const* r1, std::size_t size,
+  std::uint32_t r_offset, std::int32_t* y) noexcept {
+
+  using kernel_t = std::size_t (*)(std::uint32_t const*, std::uint32_t const*, std::size_t,
+    std::uint32_t, std::int32_t*) noexcept;
+
+  static kernel_t constexpr kernels[] = {
+    scalar::years_between,
+#if defined(__x86_64__) || defined(__i386__)
+    sse41::years_between,
+    avx2::years_between,
+    avx512::years_between,
+#endif
+  };
+
+  return kernels[std::size_t(active_tier())](r0, r1, size, r_offset, y);
+}
+
+} // namespace simd
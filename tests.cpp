@@ -28,11 +28,22 @@
  */
 
 #include "calendar.hpp"
+#include "parallel.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <ctime>
+#include <iomanip>
 #include <iostream>
+#include <numeric>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 //--------------------------------------------------------------------------------------------------
 // Config
@@ -1020,6 +1031,51 @@ TEST(fast, division_by_1461) {
   ASSERT_NE(N % 1461, std::uint32_t(u % p32) / 2939745) << "Upper bound is not sharp.";
 }
 
+/**
+ * Tests fast division by 12 (see ugregorian_t::add_months).
+ */
+TEST(fast, division_by_12) {
+  for (std::uint64_t k = 0; k < p32; ++k)
+    ASSERT_EQ(k / 12, 2863311531 * k >> 35) << "Failed for k = " << k;
+}
+
+/**
+ * Tests fast division by 10 (see to_chars).
+ */
+TEST(fast, division_by_10) {
+
+  auto constexpr N = std::uint64_t(1073741829);
+  for (std::uint64_t n = 0; n < N; ++n) {
+    auto const u = std::uint64_t(429496730) * n;
+    ASSERT_EQ(n / 10, u / p32) << "Failed for n = " << n;
+    ASSERT_EQ(n % 10, u % p32 / 429496730) << "Failed for n = " << n;
+  }
+  auto const u = std::uint64_t(429496730) * N;
+  ASSERT_NE(N % 10, u % p32 / 429496730) << "Upper bound is not sharp.";
+}
+
+/**
+ * Tests fast division by 100 (see to_chars).
+ */
+TEST(fast, division_by_100) {
+  for (std::uint32_t n = 0; n < 10000; ++n)
+    ASSERT_EQ(n / 100, n * 5243 >> 19) << "Failed for n = " << n;
+}
+
+/**
+ * Tests SWAR conversion of numbers in [0, 99] into pairs of ASCII digits in all lanes.
+ */
+TEST(fast, to_two_digits) {
+  for (std::uint64_t n = 0; n < 100; ++n) {
+    for (unsigned lane = 0; lane < 4; ++lane) {
+      auto const x = n << 16 * lane | (99 - n) << 16 * ((lane + 1) % 4);
+      auto const w = to_two_digits(x);
+      ASSERT_EQ(char('0' + n / 10), char(w >> 16 * lane    )) << "Failed for n = " << n;
+      ASSERT_EQ(char('0' + n % 10), char(w >> (16 * lane + 8))) << "Failed for n = " << n;
+    }
+  }
+}
+
 /**
  * Tests fast is divisibility by 100.
  */
@@ -1028,6 +1084,82 @@ TEST(fast, is_multiple_of_100) {
     ASSERT_EQ(n % 100 == 0, is_multiple_of_100(n)) << "Failed for n = " << n;
 }
 
+/**
+ * Tests fast division of ticks by the number of ticks per second on windows near 0, near multiples
+ * of the divisor and near 2^64 and on random numbers.
+ */
+template <std::uint32_t p>
+void
+test_ticks_to_seconds() {
+
+  auto const check = [](std::uint64_t n) {
+    ASSERT_EQ(n / p, ticks_to_seconds<p>(n)) << "Failed for n = " << n << " and p = " << p;
+  };
+
+  for (std::uint64_t i = 0; i < 1000000; ++i) {
+    check(i);
+    check(max<std::uint64_t> - i);
+    check(max<std::uint64_t> / p * p - i % 2048);
+  }
+
+  std::mt19937_64 rng;
+  for (std::uint64_t i = 0; i < 10000000; ++i) {
+    auto const n = rng();
+    check(n);
+    check(n / p * p - 1);
+  }
+}
+
+TEST(fast, ticks_to_seconds) {
+  test_ticks_to_seconds<1000      >();
+  test_ticks_to_seconds<1000000   >();
+  test_ticks_to_seconds<1000000000>();
+}
+
+/**
+ * Tests fast remainder by 7 on windows around 0, powers of 2 and 2^64 and on random numbers.
+ */
+TEST(fast, remainder_by_7) {
+
+  auto const check = [](std::uint64_t n) {
+    ASSERT_EQ(n % 7, remainder_by_7(n)) << "Failed for n = " << n;
+  };
+
+  for (std::uint64_t n = 0; n < 10000000; ++n) {
+    check(n);
+    check(~n);
+  }
+
+  for (unsigned k = 1; k < 64; ++k)
+    for (std::uint64_t n = (std::uint64_t(1) << k) - 10000; n != (std::uint64_t(1) << k) + 10000;
+      ++n)
+      check(n);
+
+  std::mt19937_64 rng;
+  for (std::uint64_t i = 0; i < 10000000; ++i)
+    check(rng());
+}
+
+/**
+ * Tests fast time of day.
+ */
+TEST(fast, to_time_of_day) {
+  for (std::uint32_t n = 0; n < 86400; ++n) {
+    auto const t = to_time_of_day(n);
+    ASSERT_EQ(n / 3600     , t.hour  ) << "Failed for n = " << n;
+    ASSERT_EQ(n % 3600 / 60, t.minute) << "Failed for n = " << n;
+    ASSERT_EQ(n % 60       , t.second) << "Failed for n = " << n;
+  }
+}
+
+/**
+ * Tests fast week of the year (see ugregorian_t::to_iso_week_date).
+ */
+TEST(fast, week_of_year) {
+  for (std::uint32_t d = 1; d <= 366; ++d)
+    ASSERT_EQ((d + 6) / 7, (73 * d + 491) / 512) << "Failed for d = " << d;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Calendar tests
 //--------------------------------------------------------------------------------------------------
@@ -1274,6 +1406,111 @@ TYPED_TEST(calendar_tests, to_rata_die_backward) {
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+// 64-bit tests
+//--------------------------------------------------------------------------------------------------
+
+// The ranges of 64-bit implementations are too large for exhaustive tests. Hence, these tests only
+// cover the limits and windows of rata dies around them and around the epoch.
+
+template <typename A>
+struct calendar_64_tests : public ::testing::Test {
+}; // struct calendar_64_tests
+
+using implementations_64 = ::testing::Types<
+  ugregorian_t<std::uint64_t, std::uint64_t>,
+  gregorian_t <std:: int64_t, std:: int64_t>,
+  gregorian_t <std:: int64_t, std:: int64_t, date_t<std::int64_t>{- 1912, 6, 23}>
+>;
+
+TYPED_TEST_SUITE(calendar_64_tests, implementations_64);
+
+/**
+ * Tests whether limits are consistent and whether rata_die_max covers the whole rata_die_t range.
+ */
+TYPED_TEST(calendar_64_tests, limits) {
+
+  using A          = TypeParam;
+  using rata_die_t = typename A::rata_die_t;
+
+  static_assert(!enable_static_asserts ||
+    A::rata_die_max == max<rata_die_t>);
+
+  static_assert(!enable_static_asserts ||
+    A::to_date(A::rata_die_min) == A::date_min);
+
+  static_assert(!enable_static_asserts ||
+    A::to_date(A::rata_die_max) == A::date_max);
+
+  static_assert(!enable_static_asserts ||
+    A::to_rata_die(A::date_min) == A::rata_die_min);
+
+  static_assert(!enable_static_asserts ||
+    A::to_rata_die(A::date_max) == A::rata_die_max);
+
+  static_assert(!enable_static_asserts ||
+    A::round_rata_die_min == A::to_rata_die(A::round_date_min));
+
+  static_assert(!enable_static_asserts ||
+    A::round_rata_die_max == A::to_rata_die(A::round_date_max));
+}
+
+/**
+ * Tests whether to_date and to_rata_die produce correct results going forward on windows of rata
+ * dies starting at rata_die_min, around 0 and ending at rata_die_max.
+ */
+TYPED_TEST(calendar_64_tests, forward) {
+
+  using A          = TypeParam;
+  using date_t     = typename A::date_t;
+  using rata_die_t = typename A::rata_die_t;
+
+  auto constexpr window = rata_die_t(1) << 20;
+
+  for (auto const first : { A::rata_die_min, rata_die_t(A::rata_die_min + window) < 0 ?
+    rata_die_t(-window) : A::rata_die_min, rata_die_t(A::rata_die_max - window) }) {
+
+    date_t date = A::to_date(first);
+    ASSERT_EQ(first, A::to_rata_die(date)) << "Failed for rata_die = " << first;
+
+    for (rata_die_t rata_die = first; rata_die < first + window; ) {
+
+      auto const tomorrow = A::to_date(++rata_die);
+
+      ASSERT_EQ(tomorrow, advance(date)) << "Failed for rata_die = " << rata_die;
+      ASSERT_EQ(rata_die, A::to_rata_die(date)) << "Failed for date = " << date;
+    }
+  }
+}
+
+/**
+ * Tests whether day_of_week is correct on windows of rata dies starting at rata_die_min, around 0
+ * and ending at rata_die_max.
+ */
+TYPED_TEST(calendar_64_tests, day_of_week) {
+
+  using A          = TypeParam;
+  using date_t     = typename A::date_t;
+  using rata_die_t = typename A::rata_die_t;
+
+  // 2000-Jan-01 was a Saturday.
+  ASSERT_EQ(6, A::day_of_week(A::to_rata_die(date_t{2000, 1, 1})));
+
+  auto constexpr window = rata_die_t(1) << 20;
+
+  for (auto const first : { A::rata_die_min, rata_die_t(A::rata_die_min + window) < 0 ?
+    rata_die_t(-window) : A::rata_die_min, rata_die_t(A::rata_die_max - window) }) {
+
+    auto previous = A::day_of_week(first);
+
+    for (rata_die_t rata_die = first; rata_die < first + window; ) {
+      auto const current = A::day_of_week(++rata_die);
+      ASSERT_EQ((previous + 1) % 7, current) << "Failed for rata_die = " << rata_die;
+      previous = current;
+    }
+  }
+}
+
 TEST(calendar_tests, show_offset) {
 
     using year_t          = int64_t;
@@ -1288,3 +1525,1736 @@ TEST(calendar_tests, show_offset) {
     std::cout << "             offset.year (u) = " << offset.year     << '\n';
     std::cout << "             offset.rata_die = " << offset.rata_die << '\n';
 }
+
+//--------------------------------------------------------------------------------------------------
+// to_date policy tests
+//--------------------------------------------------------------------------------------------------
+
+template <typename A>
+struct to_date_policy_tests : public ::testing::Test {
+}; // struct to_date_policy_tests
+
+using table_1900_2100_t = table_to_date_t<1900, 2100>;
+
+using to_date_policy_implementations = ::testing::Types<
+  ugregorian_t<std::uint16_t, std::uint32_t, table_1900_2100_t>,
+  ugregorian_t<std::uint32_t, std::uint32_t, table_1900_2100_t>,
+  ugregorian_t<std::uint64_t, std::uint64_t, table_1900_2100_t>,
+  gregorian_t <std:: int16_t, std:: int32_t, unix_epoch<std::int16_t>, table_1900_2100_t>,
+  gregorian_t <std:: int32_t, std:: int32_t, unix_epoch<std::int32_t>, table_1900_2100_t>,
+  gregorian_t <std:: int32_t, std:: int32_t, date_t<std::int32_t>{-1912, 6, 23},
+    table_to_date_t<-100, 100>>,
+  gregorian_t <std:: int64_t, std:: int64_t, unix_epoch<std::int64_t>, table_to_date_t<0, 362>>
+>;
+
+TYPED_TEST_SUITE(to_date_policy_tests, to_date_policy_implementations);
+
+/**
+ * Tests whether to_date with table_to_date_t matches to_date with eaf_to_date_t from two years
+ * before to two years after the window.
+ */
+TYPED_TEST(to_date_policy_tests, table) {
+
+  using A          = TypeParam;
+  using year_t     = typename A::year_t;
+  using rata_die_t = typename A::rata_die_t;
+
+  using B = std::conditional_t<std::is_unsigned_v<year_t>,
+    ::ugregorian_t<year_t, rata_die_t>, ::gregorian_t<year_t, rata_die_t, A::epoch>>;
+
+  auto constexpr year_starts = A::to_date_policy_t::template year_starts<A>;
+
+  static_assert(A::to_date(year_starts[1]) == B::to_date(year_starts[1]));
+
+  auto const first = year_starts.front() - 366 * 2;
+  auto const last  = year_starts.back()  + 366 * 2;
+
+  for (auto n = rata_die_t(first); n != rata_die_t(last); ++n)
+    ASSERT_EQ(B::to_date(n), A::to_date(n)) << "Failed for rata_die = " << n;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Batch tests
+//--------------------------------------------------------------------------------------------------
+
+template <typename A>
+struct batch_tests : public ::testing::Test {
+}; // struct batch_tests
+
+using batch_implementations = ::testing::Types<
+
+  // 16 bits
+
+  ugregorian_t<std::uint16_t, std::uint32_t>,
+  gregorian_t <std:: int16_t, std:: int32_t>,
+  gregorian_t <std:: int16_t, std:: int32_t, date_t<std::int16_t>{-32768, 1, 1}>,
+
+  // 32 bits
+
+  ugregorian_t<std::uint32_t, std::uint32_t>,
+  gregorian_t <std:: int32_t, std:: int32_t>,
+  gregorian_t <std:: int32_t, std:: int32_t, date_t<std::int32_t>{- 1912, 6, 23}>
+>;
+
+TYPED_TEST_SUITE(batch_tests, batch_implementations);
+
+/**
+ * Tests whether batch to_date matches scalar to_date from round_rata_die_min to round_rata_die_max.
+ */
+TYPED_TEST(batch_tests, to_date) {
+
+  using A          = TypeParam;
+  using year_t     = typename A::year_t;
+  using rata_die_t = typename A::rata_die_t;
+  using date_t     = typename A::date_t;
+
+  // Not a multiple of the number of lanes to exercise the scalar tail.
+  auto constexpr size = std::size_t(65537);
+
+  std::vector<rata_die_t> rata_dies(size);
+  std::vector<date_t>     expected (size);
+  std::vector<year_t>     years    (size);
+  std::vector<month_t>    months   (size);
+  std::vector<day_t>      days     (size);
+
+  for (std::int64_t first = A::round_rata_die_min; first <= A::round_rata_die_max; first += size) {
+
+    auto const count = std::size_t(std::min<std::int64_t>(size,
+      A::round_rata_die_max - first + 1));
+
+    std::iota(rata_dies.begin(), rata_dies.begin() + count, rata_die_t(first));
+    for (std::size_t i = 0; i < count; ++i)
+      expected[i] = A::to_date(rata_dies[i]);
+
+    for (auto tier = simd::tier_t::scalar; tier <= simd::detected_tier();
+      tier = simd::tier_t(int(tier) + 1)) {
+
+      simd::set_tier(tier);
+      A::to_date(std::span{rata_dies.data(), count}, years, months, days);
+
+      for (std::size_t i = 0; i < count; ++i)
+        ASSERT_EQ(expected[i], (date_t{years[i], months[i], days[i]})) << "Failed for rata_die = "
+          << rata_dies[i] << " and tier = " << int(tier);
+    }
+  }
+
+  simd::set_tier(simd::detected_tier());
+}
+
+/**
+ * Tests whether scalar day_of_week is correct and batch day_of_week matches it from rata_die_min
+ * to rata_die_max.
+ */
+TYPED_TEST(batch_tests, day_of_week) {
+
+  using A          = TypeParam;
+  using rata_die_t = typename A::rata_die_t;
+  using date_t     = typename A::date_t;
+
+  // 2000-Jan-01 was a Saturday.
+  ASSERT_EQ(6, A::day_of_week(A::to_rata_die(date_t{2000, 1, 1})));
+
+  // Not a multiple of the number of lanes to exercise the scalar tail.
+  auto constexpr size = std::size_t(65537);
+
+  std::vector<rata_die_t> rata_dies(size);
+  std::vector<weekday_t>  expected (size);
+  std::vector<weekday_t>  weekdays (size);
+
+  auto previous = weekday_t((A::day_of_week(A::rata_die_min) + 6) % 7);
+
+  for (std::int64_t first = A::rata_die_min; first <= A::rata_die_max; first += size) {
+
+    auto const count = std::size_t(std::min<std::int64_t>(size, A::rata_die_max - first + 1));
+
+    std::iota(rata_dies.begin(), rata_dies.begin() + count, rata_die_t(first));
+    for (std::size_t i = 0; i < count; ++i) {
+      expected[i] = A::day_of_week(rata_dies[i]);
+      ASSERT_EQ((previous + 1) % 7, expected[i]) << "Failed for rata_die = " << rata_dies[i];
+      previous = expected[i];
+    }
+
+    for (auto tier = simd::tier_t::scalar; tier <= simd::detected_tier();
+      tier = simd::tier_t(int(tier) + 1)) {
+
+      simd::set_tier(tier);
+      A::day_of_week(std::span{rata_dies.data(), count}, weekdays);
+
+      for (std::size_t i = 0; i < count; ++i)
+        ASSERT_EQ(expected[i], weekdays[i]) << "Failed for rata_die = " << rata_dies[i] <<
+          " and tier = " << int(tier);
+    }
+  }
+
+  simd::set_tier(simd::detected_tier());
+}
+
+/**
+ * Tests whether batch to_rata_die matches scalar to_rata_die from round_date_min to round_date_max.
+ */
+TYPED_TEST(batch_tests, to_rata_die) {
+
+  using A          = TypeParam;
+  using year_t     = typename A::year_t;
+  using rata_die_t = typename A::rata_die_t;
+  using date_t     = typename A::date_t;
+
+  // Not a multiple of the number of lanes to exercise the scalar tail.
+  auto constexpr size = std::size_t(65537);
+
+  std::vector<date_t>     dates    (size);
+  std::vector<year_t>     years    (size);
+  std::vector<month_t>    months   (size);
+  std::vector<day_t>      days     (size);
+  std::vector<rata_die_t> rata_dies(size);
+  std::vector<rata_die_t> columns  (size);
+
+  for (std::int64_t first = A::round_rata_die_min; first <= A::round_rata_die_max; first += size) {
+
+    auto const count = std::size_t(std::min<std::int64_t>(size,
+      A::round_rata_die_max - first + 1));
+
+    for (std::size_t i = 0; i < count; ++i) {
+      dates [i] = A::to_date(rata_die_t(first + i));
+      years [i] = dates[i].year;
+      months[i] = dates[i].month;
+      days  [i] = dates[i].day;
+    }
+
+    for (auto tier = simd::tier_t::scalar; tier <= simd::detected_tier();
+      tier = simd::tier_t(int(tier) + 1)) {
+
+      simd::set_tier(tier);
+      A::to_rata_die(std::span{dates.data(), count}, rata_dies);
+      A::to_rata_die(std::span{years.data(), count}, months, days, columns);
+
+      for (std::size_t i = 0; i < count; ++i) {
+        auto const expected = rata_die_t(first + i);
+        ASSERT_EQ(expected, rata_dies[i]) << "Failed for date = " << dates[i] << " and tier = "
+          << int(tier);
+        ASSERT_EQ(expected, columns  [i]) << "Failed for date = " << dates[i] << " and tier = "
+          << int(tier);
+      }
+    }
+  }
+
+  simd::set_tier(simd::detected_tier());
+}
+
+/**
+ * Tests whether conversions on date_columns_t match scalar ones and whether proxies read and write
+ * dates.
+ */
+TYPED_TEST(batch_tests, date_columns) {
+
+  using A          = TypeParam;
+  using rata_die_t = typename A::rata_die_t;
+  using date_t     = typename A::date_t;
+
+  auto constexpr size = std::size_t(65537);
+
+  std::vector<rata_die_t> rata_dies(size);
+  std::vector<rata_die_t> round_trip(size);
+  typename A::date_columns_t dates(size);
+
+  for (auto const first : {std::int64_t(A::round_rata_die_min),
+    std::int64_t(A::round_rata_die_max) - std::int64_t(size) + 1}) {
+
+    std::iota(rata_dies.begin(), rata_dies.end(), rata_die_t(first));
+    A::to_date(rata_dies, dates);
+    A::to_rata_die(dates, round_trip);
+
+    for (std::size_t i = 0; i < size; ++i) {
+      ASSERT_EQ(A::to_date(rata_dies[i]), date_t(dates[i])) << "Failed for rata_die = "
+        << rata_dies[i];
+      ASSERT_EQ(rata_dies[i], round_trip[i]) << "Failed for rata_die = " << rata_dies[i];
+    }
+  }
+
+  auto const u = A::to_date(rata_dies[1]);
+  dates[0] = u;
+  EXPECT_EQ(u, date_t(dates[0]));
+  dates[2] = dates[0];
+  EXPECT_EQ(u, std::as_const(dates)[2]);
+}
+
+/**
+ * Tests whether packed dates round trip, match unpacked dates and increase with rata dies from
+ * round_rata_die_min to round_rata_die_max.
+ */
+TYPED_TEST(batch_tests, packed_date) {
+
+  using A             = TypeParam;
+  using packed_date_t = typename A::packed_date_t;
+
+  auto previous = A::to_packed_date(A::round_rata_die_min);
+
+  for (auto n = A::round_rata_die_min; n < A::round_rata_die_max; ) {
+    auto const packed = A::to_packed_date(++n);
+    ASSERT_EQ(A::to_date(n), packed.unpack()) << "Failed for rata_die = " << n;
+    ASSERT_EQ(packed, packed_date_t(packed.unpack())) << "Failed for rata_die = " << n;
+    ASSERT_EQ(n, A::to_rata_die(packed)) << "Failed for rata_die = " << n;
+    ASSERT_LT(previous, packed) << "Failed for rata_die = " << n;
+    previous = packed;
+  }
+}
+
+/**
+ * Tests whether parallel conversions match single-threaded ones for different numbers of threads
+ * and chunk sizes.
+ */
+TYPED_TEST(batch_tests, parallel) {
+
+  using A          = TypeParam;
+  using rata_die_t = typename A::rata_die_t;
+  using date_t     = typename A::date_t;
+
+  // Not a multiple of chunk sizes to exercise partial chunks.
+  auto constexpr size = std::size_t(65537);
+
+  std::vector<rata_die_t>    rata_dies(size);
+  std::vector<rata_die_t>    round_trip(size);
+  std::vector<date_t>        dates(size);
+  typename A::date_columns_t columns(size);
+  typename A::date_columns_t expected(size);
+
+  for (auto const threads : {1, 3, 8}) {
+
+    thread_pool_t pool(threads);
+
+    for (auto const chunk : {std::size_t(1000), parallel_chunk_size}) {
+
+      for (auto const first : {std::int64_t(A::round_rata_die_min),
+        std::int64_t(A::round_rata_die_max) - std::int64_t(size) + 1}) {
+
+        std::iota(rata_dies.begin(), rata_dies.end(), rata_die_t(first));
+        A::to_date(rata_dies, expected);
+
+        parallel_to_date<A>(pool, rata_dies, columns, chunk);
+        ASSERT_EQ(expected.years , columns.years ) << "Failed for threads = " << threads;
+        ASSERT_EQ(expected.months, columns.months) << "Failed for threads = " << threads;
+        ASSERT_EQ(expected.days  , columns.days  ) << "Failed for threads = " << threads;
+
+        columns = typename A::date_columns_t(size);
+        parallel_to_date<A>(pool, rata_die_t(first), size, columns, chunk);
+        ASSERT_EQ(expected.years , columns.years ) << "Failed for threads = " << threads;
+        ASSERT_EQ(expected.months, columns.months) << "Failed for threads = " << threads;
+        ASSERT_EQ(expected.days  , columns.days  ) << "Failed for threads = " << threads;
+
+        std::fill(round_trip.begin(), round_trip.end(), rata_die_t(0));
+        parallel_to_rata_die<A>(pool, columns, round_trip, chunk);
+        ASSERT_EQ(rata_dies, round_trip) << "Failed for threads = " << threads;
+
+        for (std::size_t i = 0; i < size; ++i)
+          dates[i] = columns[i];
+        std::fill(round_trip.begin(), round_trip.end(), rata_die_t(0));
+        parallel_to_rata_die<A>(pool, std::span<date_t const>{dates}, round_trip, chunk);
+        ASSERT_EQ(rata_dies, round_trip) << "Failed for threads = " << threads;
+      }
+    }
+  }
+}
+
+/**
+ * Tests whether days_view_t yields the same dates as to_date forwards, backwards and through
+ * random access over a 400-year cycle at each end of the range and around its middle.
+ */
+TYPED_TEST(batch_tests, days_view) {
+
+  using A          = TypeParam;
+  using rata_die_t = typename A::rata_die_t;
+  using view_t     = days_view_t<A>;
+
+  static_assert(std::ranges::random_access_range<view_t> && std::ranges::sized_range<view_t> &&
+    std::ranges::view<view_t>);
+
+  auto constexpr size = std::int64_t(146097 + 1);
+
+  auto constexpr min = std::int64_t(A::round_rata_die_min);
+  auto constexpr max = std::int64_t(A::round_rata_die_max);
+
+  for (auto const first : {min, min + (max - min) / 2, max - size}) {
+
+    auto const view = view_t(rata_die_t(first), rata_die_t(first + size));
+    ASSERT_EQ(std::size_t(size), view.size());
+
+    auto n = rata_die_t(first);
+    for (auto const u : view) {
+      ASSERT_EQ(A::to_date(n), u) << "Failed for rata_die = " << n;
+      ++n;
+    }
+
+    for (auto const u : view | std::views::reverse) {
+      --n;
+      ASSERT_EQ(A::to_date(n), u) << "Failed for rata_die = " << n;
+    }
+
+    auto const begin = view.begin();
+    for (auto k = std::int64_t(0); k < size; k += 997) {
+      auto const i = begin + k;
+      ASSERT_EQ(A::to_date(rata_die_t(first + k)), *i) << "Failed for k = " << k;
+      ASSERT_EQ(*i, begin[k]) << "Failed for k = " << k;
+      ASSERT_EQ(k, i - begin) << "Failed for k = " << k;
+      ASSERT_EQ(*std::ranges::prev(i, k), *begin) << "Failed for k = " << k;
+    }
+  }
+}
+
+/**
+ * Tests whether months_view_t yields the same months, first rata dies and lengths as to_rata_die
+ * and last_day_of_month forwards, backwards and through random access over 800 years at each end
+ * of the range and around its middle.
+ */
+TYPED_TEST(batch_tests, months_view) {
+
+  using A          = TypeParam;
+  using year_t     = typename A::year_t;
+  using rata_die_t = typename A::rata_die_t;
+  using date_t     = typename A::date_t;
+  using view_t     = months_view_t<A>;
+
+  static_assert(std::ranges::random_access_range<view_t> && std::ranges::sized_range<view_t> &&
+    std::ranges::view<view_t>);
+
+  auto constexpr size = std::int64_t(12 * 800);
+
+  auto const min = std::int64_t(A::to_date(A::round_rata_die_min).year) + 1;
+  auto const max = std::int64_t(A::to_date(A::round_rata_die_max).year) - 1;
+
+  for (auto const first : {min, min + (max - min) / 2, max - size / 12}) {
+
+    auto const view = view_t(year_t(first), 1, year_t(first + size / 12), 1);
+    ASSERT_EQ(std::size_t(size), view.size());
+
+    auto const expected = [&](std::int64_t k) {
+      auto const y = year_t(first + k / 12);
+      auto const m = month_t(k % 12 + 1);
+      auto const n = A::to_rata_die(date_t{y, m, 1});
+      auto const l = rata_die_t(last_day_of_month(year_t(y % 400), m));
+      return typename view_t::month_info_t{y, m, n, l};
+    };
+
+    auto k = std::int64_t(0);
+    for (auto const x : view) {
+      ASSERT_EQ(expected(k), x) << "Failed for k = " << k;
+      ++k;
+    }
+
+    for (auto const x : view | std::views::reverse) {
+      --k;
+      ASSERT_EQ(expected(k), x) << "Failed for k = " << k;
+    }
+
+    auto const begin = view.begin();
+    for (k = 0; k < size; k += 97) {
+      auto const i = begin + k;
+      ASSERT_EQ(expected(k), *i) << "Failed for k = " << k;
+      ASSERT_EQ(*i, begin[k]) << "Failed for k = " << k;
+      ASSERT_EQ(k, i - begin) << "Failed for k = " << k;
+      ASSERT_EQ(*std::ranges::prev(i, k), *begin) << "Failed for k = " << k;
+    }
+  }
+}
+
+/**
+ * Tests whether years_view_t yields the same years, first rata dies and lengths as to_rata_die
+ * forwards, backwards and through random access over 800 years at each end of the range and around
+ * its middle.
+ */
+TYPED_TEST(batch_tests, years_view) {
+
+  using A          = TypeParam;
+  using year_t     = typename A::year_t;
+  using rata_die_t = typename A::rata_die_t;
+  using date_t     = typename A::date_t;
+  using view_t     = years_view_t<A>;
+
+  static_assert(std::ranges::random_access_range<view_t> && std::ranges::sized_range<view_t> &&
+    std::ranges::view<view_t>);
+
+  auto constexpr size = std::int64_t(800);
+
+  auto const min = std::int64_t(A::to_date(A::round_rata_die_min).year) + 1;
+  auto const max = std::int64_t(A::to_date(A::round_rata_die_max).year) - 1;
+
+  for (auto const first : {min, min + (max - min) / 2, max - size}) {
+
+    auto const view = view_t(year_t(first), year_t(first + size));
+    ASSERT_EQ(std::size_t(size), view.size());
+
+    auto const expected = [&](std::int64_t k) {
+      auto const y = year_t(first + k);
+      auto const n = A::to_rata_die(date_t{y, 1, 1});
+      auto const l = rata_die_t(A::to_rata_die(date_t{year_t(y + 1), 1, 1}) - n);
+      return typename view_t::year_info_t{y, n, l};
+    };
+
+    auto k = std::int64_t(0);
+    for (auto const x : view) {
+      ASSERT_EQ(expected(k), x) << "Failed for k = " << k;
+      ++k;
+    }
+
+    for (auto const x : view | std::views::reverse) {
+      --k;
+      ASSERT_EQ(expected(k), x) << "Failed for k = " << k;
+    }
+
+    auto const begin = view.begin();
+    for (k = 0; k < size; k += 7) {
+      auto const i = begin + k;
+      ASSERT_EQ(expected(k), *i) << "Failed for k = " << k;
+      ASSERT_EQ(*i, begin[k]) << "Failed for k = " << k;
+      ASSERT_EQ(k, i - begin) << "Failed for k = " << k;
+      ASSERT_EQ(*std::ranges::prev(i, k), *begin) << "Failed for k = " << k;
+    }
+  }
+}
+
+/**
+ * Tests whether to_date_sorted matches batch to_date on runs of rata dies which repeat, step
+ * forwards, jump and step backwards at each end of the range and around its middle.
+ */
+TYPED_TEST(batch_tests, to_date_sorted) {
+
+  using A          = TypeParam;
+  using rata_die_t = typename A::rata_die_t;
+  using date_t     = typename A::date_t;
+
+  auto constexpr size = std::size_t(65537);
+
+  auto constexpr min = std::int64_t(A::round_rata_die_min);
+  auto constexpr max = std::int64_t(A::round_rata_die_max);
+
+  std::vector<rata_die_t>    rata_dies;
+  typename A::date_columns_t expected(size);
+  typename A::date_columns_t columns (size);
+
+  std::mt19937 rng;
+
+  for (auto const first : {min, min + (max - min) / 2, max - std::int64_t(size)}) {
+
+    rata_dies.clear();
+    for (auto n = first; rata_dies.size() < size; ) {
+      rata_dies.push_back(rata_die_t(std::clamp(n, min, max)));
+      auto const k = rng() % 100;
+      n += k < 20 ? 0 : k < 95 ? 1 : k < 98 ? 40 : -5;
+    }
+
+    A::to_date(rata_dies, expected);
+    A::to_date_sorted(rata_dies, columns);
+
+    for (std::size_t i = 0; i < size; ++i)
+      ASSERT_EQ(date_t(expected[i]), date_t(columns[i])) << "Failed for rata_die = "
+        << rata_dies[i];
+  }
+}
+
+/**
+ * Tests to_date_sorted when the month of rata_die_max extends beyond max<rata_die_t>.
+ */
+TEST(to_date_sorted, wrap_around) {
+
+  using A          = ugregorian_t<std::uint64_t>;
+  using rata_die_t = A::rata_die_t;
+
+  auto const rata_dies = std::vector<rata_die_t>{A::rata_die_max - 40, A::rata_die_max,
+    A::rata_die_min, A::rata_die_min + 3, A::rata_die_max, A::rata_die_min};
+
+  A::date_columns_t columns(rata_dies.size());
+  A::to_date_sorted(rata_dies, columns);
+
+  for (std::size_t i = 0; i < rata_dies.size(); ++i)
+    ASSERT_EQ(A::to_date(rata_dies[i]), A::date_t(columns[i])) << "Failed for rata_die = "
+      << rata_dies[i];
+}
+
+/**
+ * Tests packed dates at the limits of their year types.
+ */
+TEST(packed_date, limits) {
+
+  auto constexpr check = [](auto const& u, auto const& v) {
+    using date_t        = std::remove_cvref_t<decltype(u)>;
+    using packed_date_t = ::packed_date_t<decltype(u.year)>;
+    return u < v && packed_date_t(u) < packed_date_t(v) &&
+      packed_date_t(u).unpack() == u && packed_date_t(v).unpack() == v &&
+      packed_date_t(date_t{}).unpack() == date_t{};
+  };
+
+  static_assert(check(min<date_t<std::int16_t >>, max<date_t<std::int16_t >>));
+  static_assert(check(min<date_t<std::uint16_t>>, max<date_t<std::uint16_t>>));
+  static_assert(check(min<date_t<std::int32_t >>, max<date_t<std::int32_t >>));
+  static_assert(check(min<date_t<std::uint32_t>>, max<date_t<std::uint32_t>>));
+
+  auto constexpr y54 = std::int64_t(1) << 54;
+  static_assert(check(date_t<std::int64_t>{-y54, 1, 1}, date_t<std::int64_t>{y54 - 1, 12, 31}));
+  static_assert(check(date_t<std::int64_t>{-1, 12, 31}, date_t<std::int64_t>{0, 1, 1}));
+  static_assert(check(date_t<std::uint64_t>{0, 1, 1}, date_t<std::uint64_t>{2 * y54 - 1, 12, 31}));
+}
+
+template <typename T>
+struct batch_year_tests : public ::testing::Test {
+}; // struct batch_year_tests
+
+using batch_year_types = ::testing::Types<std::int16_t, std::uint16_t, std::int32_t, std::int64_t>;
+
+TYPED_TEST_SUITE(batch_year_tests, batch_year_types);
+
+/**
+ * Tests whether batch is_leap_year matches scalar is_leap_year from max(min<T>, -536870800) to
+ * min(max<T>, 536870999).
+ */
+TYPED_TEST(batch_year_tests, is_leap_year) {
+
+  using T = TypeParam;
+
+  auto constexpr first_year = std::max<std::int64_t>(min<T>, -536870800);
+  auto constexpr last_year  = std::min<std::int64_t>(max<T>,  536870999);
+
+  // Not a multiple of 64 to exercise the scalar tail.
+  auto constexpr size = std::size_t(1048577);
+
+  std::vector<T>             years   (size);
+  std::vector<std::uint64_t> expected((size + 63) / 64);
+  std::vector<std::uint64_t> bits    ((size + 63) / 64);
+
+  for (std::int64_t first = first_year; first <= last_year; first += size) {
+
+    auto const count = std::size_t(std::min<std::int64_t>(size, last_year - first + 1));
+    auto const words = (count + 63) / 64;
+
+    std::iota(years.begin(), years.begin() + count, T(first));
+    std::fill(expected.begin(), expected.end(), 0);
+    for (std::size_t i = 0; i < count; ++i)
+      expected[i / 64] |= std::uint64_t(is_leap_year(years[i])) << i % 64;
+
+    for (auto tier = simd::tier_t::scalar; tier <= simd::detected_tier();
+      tier = simd::tier_t(int(tier) + 1)) {
+
+      simd::set_tier(tier);
+      std::fill(bits.begin(), bits.end(), 0);
+      is_leap_year(std::span<T const>{years.data(), count}, bits);
+
+      for (std::size_t i = 0; i < words; ++i)
+        ASSERT_EQ(expected[i], bits[i]) << "Failed for years from " << years[64 * i]
+          << " and tier = " << int(tier);
+    }
+  }
+
+  simd::set_tier(simd::detected_tier());
+}
+
+/**
+ * Tests whether batch last_day_of_month matches scalar last_day_of_month for all months of years
+ * in [-32768, 65535] and near the bounds of [-536870800, 536870999] (intersected with T's range).
+ */
+TYPED_TEST(batch_year_tests, last_day_of_month) {
+
+  using T = TypeParam;
+
+  // Not a multiple of the number of lanes to exercise the scalar tail.
+  auto constexpr size = std::size_t(12 * 65537);
+
+  std::vector<T>       years   (size);
+  std::vector<month_t> months  (size);
+  std::vector<day_t>   expected(size);
+  std::vector<day_t>   days    (size);
+
+  std::int64_t constexpr windows[][2] = {
+    {-536870800, -536805264},
+    {    -32768,      65535},
+    { 536805463,  536870999},
+  };
+
+  for (auto const& window : windows) {
+
+    auto const first_year = std::max<std::int64_t>(min<T>, window[0]);
+    auto const last_year  = std::min<std::int64_t>(max<T>, window[1]);
+
+    for (std::int64_t first = first_year; first <= last_year; first += size / 12) {
+
+      auto const count = 12 * std::size_t(std::min<std::int64_t>(size / 12,
+        last_year - first + 1));
+
+      for (std::size_t i = 0; i < count; ++i) {
+        years   [i] = T(first + std::int64_t(i / 12));
+        months  [i] = month_t(i % 12 + 1);
+        expected[i] = last_day_of_month(years[i], months[i]);
+      }
+
+      for (auto tier = simd::tier_t::scalar; tier <= simd::detected_tier();
+        tier = simd::tier_t(int(tier) + 1)) {
+
+        simd::set_tier(tier);
+        last_day_of_month(std::span<T const>{years.data(), count}, months, days);
+
+        for (std::size_t i = 0; i < count; ++i)
+          ASSERT_EQ(expected[i], days[i]) << "Failed for year = " << years[i] << ", month = "
+            << std::uint32_t(months[i]) << " and tier = " << int(tier);
+      }
+    }
+  }
+
+  simd::set_tier(simd::detected_tier());
+}
+
+//--------------------------------------------------------------------------------------------------
+// Date and time tests
+//--------------------------------------------------------------------------------------------------
+
+template <typename A>
+struct date_time_tests : public ::testing::Test {
+}; // struct date_time_tests
+
+using date_time_implementations = ::testing::Types<
+  gregorian_t<std::int16_t, std::int32_t>,
+  gregorian_t<std::int32_t, std::int32_t>,
+  gregorian_t<std::int32_t, std::int32_t, date_t<std::int32_t>{- 1912, 6, 23}>,
+  gregorian_t<std::int64_t, std::int64_t>
+>;
+
+TYPED_TEST_SUITE(date_time_tests, date_time_implementations);
+
+/**
+ * Tests whether to_date_time limits are consistent with to_date limits.
+ */
+TYPED_TEST(date_time_tests, limits) {
+
+  using A = TypeParam;
+
+  static_assert(!enable_static_asserts ||
+    A::to_date_time(A::seconds_min).time == time_of_day_t{0, 0, 0} ||
+    A::seconds_min / 86400 != A::rata_die_min);
+
+  static_assert(!enable_static_asserts ||
+    A::to_date_time(A::seconds_max).time == time_of_day_t{23, 59, 59} ||
+    A::seconds_max == max<seconds_t>);
+
+  static_assert(!enable_static_asserts ||
+    A::to_date_time(A::seconds_min).date == A::to_date(A::rata_die_min) ||
+    A::seconds_min / 86400 != A::rata_die_min);
+
+  static_assert(!enable_static_asserts ||
+    A::to_date_time(A::seconds_max).date == A::to_date(A::rata_die_max) ||
+    A::seconds_max == max<seconds_t>);
+}
+
+/**
+ * Tests whether to_date_time, scalar and batch, match the composition of floored division,
+ * to_date and built-in operators / and % on windows of seconds starting at seconds_min, around 0
+ * and ending at seconds_max.
+ */
+TYPED_TEST(date_time_tests, to_date_time) {
+
+  using A           = TypeParam;
+  using date_time_t = typename A::date_time_t;
+  using rata_die_t  = typename A::rata_die_t;
+
+  // Not a multiple of 86400 to exercise different seconds of day at each window's end.
+  auto constexpr size = std::size_t(1) << 22;
+
+  std::vector<seconds_t>   seconds   (size);
+  std::vector<date_time_t> date_times(size);
+
+  for (auto const first : { A::seconds_min, -seconds_t(size / 2),
+    A::seconds_max - seconds_t(size - 1) }) {
+
+    std::iota(seconds.begin(), seconds.end(), first);
+    A::to_date_time(seconds, date_times);
+
+    for (std::size_t i = 0; i < size; ++i) {
+
+      auto const s = seconds[i];
+      auto const n = s / 86400 - (s % 86400 < 0);
+      auto const r = std::uint32_t(s - 86400 * n);
+
+      auto const expected = date_time_t{A::to_date(rata_die_t(n)), time_of_day_t{hour_t(r / 3600),
+        minute_t(r % 3600 / 60), second_t(r % 60)}};
+
+      ASSERT_EQ(expected, A::to_date_time(s)) << "Failed for seconds = " << s;
+      ASSERT_EQ(expected, date_times[i]) << "Failed for seconds = " << s;
+    }
+  }
+}
+
+/**
+ * Tests whether to_date_time matches gmtime_r on random Unix times.
+ */
+TEST(date_time_tests, gmtime) {
+
+  using A = gregorian_t<std::int32_t, std::int32_t>;
+
+  std::mt19937_64 rng;
+  std::uniform_int_distribution<seconds_t> dist(A::seconds_min, A::seconds_max);
+
+  for (std::size_t i = 0; i < 1000000; ++i) {
+
+    auto const s = dist(rng);
+    auto const t = std::time_t(s);
+    std::tm    tm;
+    ASSERT_NE(nullptr, gmtime_r(&t, &tm)) << "Failed for seconds = " << s;
+
+    auto const u = A::to_date_time(s);
+    ASSERT_EQ(std::int64_t(tm.tm_year) + 1900, u.date.year  ) << "Failed for seconds = " << s;
+    ASSERT_EQ(tm.tm_mon + 1                  , u.date.month ) << "Failed for seconds = " << s;
+    ASSERT_EQ(tm.tm_mday                     , u.date.day   ) << "Failed for seconds = " << s;
+    ASSERT_EQ(tm.tm_hour                     , u.time.hour  ) << "Failed for seconds = " << s;
+    ASSERT_EQ(tm.tm_min                      , u.time.minute) << "Failed for seconds = " << s;
+    ASSERT_EQ(tm.tm_sec                      , u.time.second) << "Failed for seconds = " << s;
+  }
+}
+
+/**
+ * Tests whether to_precise_date_time<p>, scalar and batch, matches the composition of floored
+ * division by p and to_date_time on a sweep over [ticks_min<p>, ticks_max<p>] and on windows of
+ * ticks starting at ticks_min<p>, around 0 and ending at ticks_max<p>.
+ */
+template <typename A, std::uint32_t p>
+void
+test_to_precise_date_time() {
+
+  using precise_date_time_t = typename A::precise_date_time_t;
+
+  auto constexpr first = A::template ticks_min<p>;
+  auto constexpr last  = A::template ticks_max<p>;
+  auto constexpr size  = std::int64_t(1) << 16;
+  // last - first might not be representable by std::int64_t but it is by std::uint64_t.
+  auto constexpr step  = (std::uint64_t(last) - std::uint64_t(first)) / size - 1;
+
+  std::vector<std::int64_t> ticks;
+  for (std::int64_t i = 0; i < size; ++i) {
+    ticks.push_back(std::int64_t(std::uint64_t(first) + i * step));
+    ticks.push_back(first + i);
+    ticks.push_back(i - size / 2);
+    ticks.push_back(last - i);
+  }
+
+  std::vector<precise_date_time_t> date_times(ticks.size());
+  A::template to_precise_date_time<p>(ticks, date_times);
+
+  for (std::size_t i = 0; i < ticks.size(); ++i) {
+
+    auto const t = ticks[i];
+    auto const s = t / p - (t % p < 0);
+    auto const u = A::to_date_time(s);
+
+    auto const expected = precise_date_time_t{u.date, u.time, std::uint32_t(t - p * s)};
+
+    ASSERT_EQ(expected, A::template to_precise_date_time<p>(t)) << "Failed for ticks = " << t <<
+      " and p = " << p;
+    ASSERT_EQ(expected, date_times[i]) << "Failed for ticks = " << t << " and p = " << p;
+  }
+}
+
+TYPED_TEST(date_time_tests, to_precise_date_time) {
+  test_to_precise_date_time<TypeParam, 1000      >();
+  test_to_precise_date_time<TypeParam, 1000000   >();
+  test_to_precise_date_time<TypeParam, 1000000000>();
+}
+
+/**
+ * Tests whether from_rfc_3339<p> inverts to_rfc_3339<p>, for all offsets, on windows of ticks
+ * starting near ticks_min<p>, around 0 and ending near ticks_max<p> and on random ticks.
+ */
+template <typename A, std::uint32_t p>
+void
+test_rfc_3339() {
+
+  // Ticks are kept one day (the largest offset) away from the round trip limits.
+  auto constexpr day   = 86400 * std::int64_t(p);
+  auto constexpr first = std::int64_t(std::max(__int128_t(A::template ticks_min<p>),
+    __int128_t(A::round_rata_die_min) * day) + day);
+  auto constexpr last  = std::int64_t(std::min(__int128_t(A::template ticks_max<p>),
+    __int128_t(A::round_rata_die_max) * day) - day);
+  auto constexpr size  = std::int64_t(1) << 12;
+
+  std::mt19937 rng;
+  std::uniform_int_distribution<std::int64_t> uniform_ticks(first, last);
+  std::uniform_int_distribution<std::int32_t> uniform_offset(-1439, 1439);
+
+  std::vector<std::int64_t> ticks;
+  for (std::int64_t i = 0; i < size; ++i) {
+    ticks.push_back(first + i);
+    ticks.push_back(i - size / 2);
+    ticks.push_back(last - i);
+    ticks.push_back(uniform_ticks(rng));
+  }
+
+  char buffer[A::rfc_3339_size];
+
+  for (auto const t : ticks) {
+    for (auto const offset : { 0, 1, -1, 330, -570, 1439, -1439, uniform_offset(rng) }) {
+
+      auto const r = A::template to_rfc_3339<p>(buffer, std::end(buffer), t, offset);
+      ASSERT_EQ(std::errc(), r.ec) << "Failed for ticks = " << t << " and offset = " << offset;
+
+      std::int64_t t1 = 0;
+      std::int32_t o1 = 0;
+      auto const s = A::template from_rfc_3339<p>(buffer, r.ptr, t1, o1);
+      ASSERT_EQ(std::errc(), s.ec) << "Failed for " << std::string(buffer, r.ptr);
+      ASSERT_EQ(r.ptr, s.ptr) << "Failed for " << std::string(buffer, r.ptr);
+      ASSERT_EQ(t, t1) << "Failed for " << std::string(buffer, r.ptr);
+      ASSERT_EQ(offset, o1) << "Failed for " << std::string(buffer, r.ptr);
+    }
+  }
+}
+
+/**
+ * Tests to_rfc_3339 and from_rfc_3339 on round trips and, for the Unix epoch, on examples and on
+ * invalid inputs.
+ */
+TYPED_TEST(date_time_tests, rfc_3339) {
+
+  using A = TypeParam;
+
+  auto const to_string = [](std::int64_t t, std::int32_t offset) {
+    char buffer[A::rfc_3339_size];
+    return std::string(buffer, A::to_rfc_3339(buffer, t, offset));
+  };
+
+  auto const from_string = [](std::string const& s) {
+    std::int64_t t = 0;
+    auto const r = A::from_rfc_3339(s.data(), s.data() + s.size(), t);
+    return std::make_pair(r.ec, t);
+  };
+
+  test_rfc_3339<A, 1000      >();
+  test_rfc_3339<A, 1000000   >();
+  test_rfc_3339<A, 1000000000>();
+
+  // Examples below are in nanoseconds since 1970-Jan-01.
+  if constexpr (A::epoch == unix_epoch<typename A::year_t>) {
+
+    auto constexpr ns = std::int64_t(1000000000);
+
+    auto const t = A::to_seconds({{2024, 3, 10}, {12, 34, 56}}) * ns + 123456789;
+
+    ASSERT_EQ("2024-03-10T12:34:56.123456789Z", to_string(t, 0));
+    ASSERT_EQ("2024-03-10T18:04:56.123456789+05:30", to_string(t, 330));
+    ASSERT_EQ("2024-03-10T03:04:56.123456789-09:30", to_string(t, -570));
+
+    for (auto const s : { "2024-03-10T12:34:56.123456789Z", "2024-03-10t12:34:56.123456789z",
+      "2024-03-10 12:34:56.1234567891234Z", "2024-03-10T18:04:56.123456789+05:30",
+      "2024-03-10T03:04:56.123456789-09:30" })
+      ASSERT_EQ(std::make_pair(std::errc(), t), from_string(s)) << "Failed for " << s;
+
+    auto const u = A::to_seconds({{2024, 3, 10}, {12, 34, 56}}) * ns;
+    ASSERT_EQ(std::make_pair(std::errc(), u), from_string("2024-03-10T12:34:56Z"));
+    ASSERT_EQ(std::make_pair(std::errc(), u + 500000000), from_string("2024-03-10T12:34:56.5Z"));
+    ASSERT_EQ(std::make_pair(std::errc(), u), from_string("2024-03-10T12:34:56-00:00"));
+
+    for (auto const s : { "", "2024-03-10", "2024-03-10T12:34:56", "2024-03-10X12:34:56Z",
+      "2024-03-10T24:00:00Z", "2024-03-10T12:60:00Z", "2024-03-10T12:34:60Z",
+      "2024-03-10T12:34:56.Z", "2024-03-10T12:34:56+05:3", "2024-03-10T12:34:56+24:00",
+      "2024-03-10T12:34:56+05-30", "2024-03-10T12:3a:56Z", "2024-02-30T12:34:56Z" }) {
+      std::int64_t t1 = 1;
+      std::string const str = s;
+      auto const r = A::from_rfc_3339(str.data(), str.data() + str.size(), t1);
+      ASSERT_EQ(std::errc::invalid_argument, r.ec) << "Failed for " << s;
+      ASSERT_EQ(str.data(), r.ptr) << "Failed for " << s;
+      ASSERT_EQ(1, t1) << "Failed for " << s;
+    }
+
+    ASSERT_EQ(std::errc::result_out_of_range, from_string("+9999999-01-01T00:00:00Z").first);
+  }
+}
+
+/**
+ * Tests whether to_seconds, scalar and batch, inverts to_date_time on windows of seconds starting
+ * at round_seconds_min, around 0 and ending at round_seconds_max.
+ */
+TYPED_TEST(date_time_tests, to_seconds) {
+
+  using A           = TypeParam;
+  using year_t      = typename A::year_t;
+
+  auto constexpr size = std::size_t(1) << 20;
+
+  std::vector<year_t>        years  (size);
+  std::vector<month_t>       months (size);
+  std::vector<day_t>         days   (size);
+  std::vector<hour_t>        hours  (size);
+  std::vector<minute_t>      minutes(size);
+  std::vector<second_t>      secs   (size);
+  std::vector<seconds_t>     seconds(size);
+  std::vector<std::uint64_t> valid  ((size + 63) / 64);
+
+  for (auto const first : { A::round_seconds_min, -seconds_t(size / 2),
+    A::round_seconds_max - seconds_t(size - 1) }) {
+
+    for (std::size_t i = 0; i < size; ++i) {
+      auto const u = A::to_date_time(first + seconds_t(i));
+      ASSERT_EQ(first + seconds_t(i), A::to_seconds(u)) << "Failed for date_time = " << u;
+      years  [i] = u.date.year;
+      months [i] = u.date.month;
+      days   [i] = u.date.day;
+      hours  [i] = u.time.hour;
+      minutes[i] = u.time.minute;
+      secs   [i] = u.time.second;
+    }
+
+    A::to_seconds(years, months, days, hours, minutes, secs, seconds);
+    for (std::size_t i = 0; i < size; ++i)
+      ASSERT_EQ(first + seconds_t(i), seconds[i]) << "Failed for i = " << i;
+
+    std::fill(seconds.begin(), seconds.end(), 0);
+    A::to_seconds(years, months, days, hours, minutes, secs, seconds, valid);
+    for (std::size_t i = 0; i < size; ++i)
+      ASSERT_EQ(first + seconds_t(i), seconds[i]) << "Failed for i = " << i;
+    for (auto const word : valid)
+      ASSERT_EQ(max<std::uint64_t>, word);
+  }
+}
+
+/**
+ * Tests whether the validation bitmap of to_seconds flags out of range fields and results.
+ */
+TYPED_TEST(date_time_tests, to_seconds_validation) {
+
+  using A           = TypeParam;
+  using date_time_t = typename A::date_time_t;
+  using year_t      = typename A::year_t;
+
+  auto const first = A::to_date_time(A::round_seconds_min);
+  auto const last  = A::to_date_time(A::round_seconds_max);
+  auto const year  = year_t(2000);
+
+  struct input_t {
+    date_time_t date_time;
+    bool        valid;
+  };
+
+  std::vector<input_t> const inputs = {
+    { first                                  , true  },
+    { last                                   , true  },
+    { date_time_t{{year,  2, 29}, {23, 59, 59}}, true  },
+    { date_time_t{{year,  2, 30}, { 0,  0,  0}}, false },
+    { date_time_t{{year,  0,  1}, { 0,  0,  0}}, false },
+    { date_time_t{{year, 13,  1}, { 0,  0,  0}}, false },
+    { date_time_t{{year,  4,  0}, { 0,  0,  0}}, false },
+    { date_time_t{{year,  4, 31}, { 0,  0,  0}}, false },
+    { date_time_t{{year, 12, 31}, {24,  0,  0}}, false },
+    { date_time_t{{year, 12, 31}, { 0, 60,  0}}, false },
+    { date_time_t{{year, 12, 31}, { 0,  0, 60}}, false },
+  };
+
+  // Extends inputs with dates just outside the limits, if representable.
+  auto extended = inputs;
+
+  if (min<date_t<year_t>> < first.date)
+    extended.push_back({ date_time_t{previous(first.date), first.time}, false });
+
+  if (last.time == time_of_day_t{23, 59, 59} && last.date < max<date_t<year_t>>)
+    extended.push_back({ date_time_t{next(last.date), {0, 0, 0}}, false });
+
+  // Repeats inputs to fill more than one word.
+  std::vector<input_t> all;
+  while (all.size() < 100)
+    all.insert(all.end(), extended.begin(), extended.end());
+
+  auto const size = all.size();
+
+  std::vector<year_t>        years  (size);
+  std::vector<month_t>       months (size);
+  std::vector<day_t>         days   (size);
+  std::vector<hour_t>        hours  (size);
+  std::vector<minute_t>      minutes(size);
+  std::vector<second_t>      secs   (size);
+  std::vector<seconds_t>     seconds(size);
+  std::vector<std::uint64_t> valid  ((size + 63) / 64);
+
+  for (std::size_t i = 0; i < size; ++i) {
+    auto const& u = all[i].date_time;
+    years  [i] = u.date.year;
+    months [i] = u.date.month;
+    days   [i] = u.date.day;
+    hours  [i] = u.time.hour;
+    minutes[i] = u.time.minute;
+    secs   [i] = u.time.second;
+  }
+
+  A::to_seconds(years, months, days, hours, minutes, secs, seconds, valid);
+
+  for (std::size_t i = 0; i < size; ++i)
+    ASSERT_EQ(all[i].valid, bool(valid[i / 64] >> (i % 64) & 1)) << "Failed for date_time = " <<
+      all[i].date_time;
+
+  ASSERT_EQ(0, valid.back() >> (size % 64)) << "Unused bits are not cleared.";
+}
+
+/**
+ * Tests whether to_seconds matches timegm on random dates and times.
+ */
+TEST(date_time_tests, timegm) {
+
+  using A = gregorian_t<std::int32_t, std::int32_t>;
+
+  std::mt19937_64 rng;
+  std::uniform_int_distribution<seconds_t> dist(A::round_seconds_min,
+    A::round_seconds_max);
+
+  for (std::size_t i = 0; i < 1000000; ++i) {
+
+    auto const u = A::to_date_time(dist(rng));
+
+    std::tm tm  = {};
+    tm.tm_year  = int(u.date.year - 1900);
+    tm.tm_mon   = u.date.month - 1;
+    tm.tm_mday  = u.date.day;
+    tm.tm_hour  = u.time.hour;
+    tm.tm_min   = u.time.minute;
+    tm.tm_sec   = u.time.second;
+
+    ASSERT_EQ(seconds_t(::timegm(&tm)), A::to_seconds(u)) << "Failed for date_time = " << u;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Ordinal and ISO 8601 week date tests
+//--------------------------------------------------------------------------------------------------
+
+template <typename A>
+struct week_date_tests : public ::testing::Test {
+}; // struct week_date_tests
+
+using week_date_implementations = ::testing::Types<
+
+  // 16 bits
+
+  ugregorian_t<std::uint16_t, std::uint32_t>,
+  gregorian_t <std:: int16_t, std:: int32_t>,
+
+  // 32 bits
+
+  ugregorian_t<std::uint32_t, std::uint32_t>,
+  gregorian_t <std:: int32_t, std:: int32_t>,
+  gregorian_t <std:: int32_t, std:: int32_t, date_t<std::int32_t>{- 1912, 6, 23}>,
+
+  // 64 bits
+
+  ugregorian_t<std::uint64_t, std::uint64_t>,
+  gregorian_t <std:: int64_t, std:: int64_t>
+>;
+
+TYPED_TEST_SUITE(week_date_tests, week_date_implementations);
+
+/**
+ * Returns the first days of windows of rata dies starting at January 4th of the year after
+ * round_date_min, around 2000-Jan-01 and ending at December 28th of the year before round_date_max.
+ * (January 4th and December 28th are always in weeks of their calendar years.)
+ *
+ * @tparam A          Calendar implementation.
+ * @param  window     Size of windows.
+ */
+template <typename A>
+std::vector<typename A::rata_die_t>
+week_date_windows(typename A::rata_die_t window) {
+
+  using date_t     = typename A::date_t;
+  using year_t     = typename A::year_t;
+  using rata_die_t = typename A::rata_die_t;
+
+  auto const first = A::to_rata_die(date_t{year_t(A::round_date_min.year + 1), 1, 4});
+  auto const last  = A::to_rata_die(date_t{year_t(A::round_date_max.year - 1), 12, 28});
+  auto const y2k   = A::to_rata_die(date_t{2000, 1, 1});
+
+  return { first, rata_die_t(y2k - window / 2), rata_die_t(last - window + 1) };
+}
+
+/**
+ * Tests whether to_ordinal_date and its inverse, scalar and batch, match the day of the year
+ * obtained from to_date on windows of rata dies.
+ */
+TYPED_TEST(week_date_tests, ordinal_date) {
+
+  using A              = TypeParam;
+  using ordinal_date_t = typename A::ordinal_date_t;
+  using rata_die_t     = typename A::rata_die_t;
+
+  // Days in months preceding the given one (in common years).
+  std::uint32_t constexpr days_before[] = { 0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304,
+    334 };
+
+  auto constexpr size = std::size_t(1) << 20;
+
+  ASSERT_EQ((ordinal_date_t{2000, 60}), A::to_ordinal_date(A::to_rata_die({2000, 2, 29})));
+  ASSERT_EQ((ordinal_date_t{2000, 366}), A::to_ordinal_date(A::to_rata_die({2000, 12, 31})));
+  ASSERT_EQ((ordinal_date_t{2100, 60}), A::to_ordinal_date(A::to_rata_die({2100, 3, 1})));
+
+  std::vector<rata_die_t>     rata_dies    (size);
+  std::vector<ordinal_date_t> ordinal_dates(size);
+  std::vector<rata_die_t>     round_trips  (size);
+
+  for (auto const first : week_date_windows<A>(rata_die_t(size))) {
+
+    std::iota(rata_dies.begin(), rata_dies.end(), first);
+    A::to_ordinal_date(rata_dies, ordinal_dates);
+    A::from_ordinal_date(ordinal_dates, round_trips);
+
+    for (std::size_t i = 0; i < size; ++i) {
+
+      auto const rata_die = rata_dies[i];
+      auto const date     = A::to_date(rata_die);
+      auto const expected = ordinal_date_t{date.year, day_of_year_t(days_before[date.month] +
+        date.day + (date.month > 2 && is_leap_year(date.year)))};
+
+      ASSERT_EQ(expected, A::to_ordinal_date(rata_die)) << "Failed for rata_die = " << rata_die;
+      ASSERT_EQ(expected, ordinal_dates[i]) << "Failed for rata_die = " << rata_die;
+      ASSERT_EQ(rata_die, A::from_ordinal_date(expected)) << "Failed for ordinal_date = " <<
+        expected;
+      ASSERT_EQ(rata_die, round_trips[i]) << "Failed for ordinal_date = " << expected;
+    }
+  }
+}
+
+/**
+ * Tests whether to_iso_week_date and its inverse, scalar and batch, match the week of the Thursday
+ * obtained from to_date and day_of_week on windows of rata dies.
+ */
+TYPED_TEST(week_date_tests, iso_week_date) {
+
+  using A               = TypeParam;
+  using date_t          = typename A::date_t;
+  using iso_week_date_t = typename A::iso_week_date_t;
+  using rata_die_t      = typename A::rata_die_t;
+
+  auto constexpr size = std::size_t(1) << 20;
+
+  auto const iso = [](date_t const& u) { return A::to_iso_week_date(A::to_rata_die(u)); };
+
+  ASSERT_EQ((iso_week_date_t{2004, 53, 6}), iso({2005,  1,  1}));
+  ASSERT_EQ((iso_week_date_t{2004, 53, 7}), iso({2005,  1,  2}));
+  ASSERT_EQ((iso_week_date_t{2008,  1, 1}), iso({2007, 12, 31}));
+  ASSERT_EQ((iso_week_date_t{2008, 52, 7}), iso({2008, 12, 28}));
+  ASSERT_EQ((iso_week_date_t{2009,  1, 3}), iso({2008, 12, 31}));
+  ASSERT_EQ((iso_week_date_t{2009, 53, 7}), iso({2010,  1,  3}));
+  ASSERT_EQ((iso_week_date_t{2020, 53, 4}), iso({2020, 12, 31}));
+
+  std::vector<rata_die_t>      rata_dies (size);
+  std::vector<iso_week_date_t> week_dates(size);
+  std::vector<rata_die_t>      round_trips(size);
+
+  for (auto const first : week_date_windows<A>(rata_die_t(size))) {
+
+    std::iota(rata_dies.begin(), rata_dies.end(), first);
+    A::to_iso_week_date(rata_dies, week_dates);
+    A::from_iso_week_date(week_dates, round_trips);
+
+    for (std::size_t i = 0; i < size; ++i) {
+
+      auto const rata_die = rata_dies[i];
+      auto const w        = A::day_of_week(rata_die);
+      auto const weekday  = weekday_t(w == 0 ? 7 : w);
+      auto const thursday = A::to_date(rata_die_t(rata_die + 4 - weekday));
+      auto const jan_1st  = A::to_rata_die(date_t{thursday.year, 1, 1});
+      auto const week     = week_t((A::to_rata_die(thursday) - jan_1st) / 7 + 1);
+      auto const expected = iso_week_date_t{thursday.year, week, weekday};
+
+      ASSERT_EQ(expected, A::to_iso_week_date(rata_die)) << "Failed for rata_die = " << rata_die;
+      ASSERT_EQ(expected, week_dates[i]) << "Failed for rata_die = " << rata_die;
+      ASSERT_EQ(rata_die, A::from_iso_week_date(expected)) << "Failed for week_date = " <<
+        expected;
+      ASSERT_EQ(rata_die, round_trips[i]) << "Failed for week_date = " << expected;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Month arithmetic tests
+//--------------------------------------------------------------------------------------------------
+
+template <typename A>
+struct month_arithmetic_tests : public ::testing::Test {
+}; // struct month_arithmetic_tests
+
+using month_arithmetic_implementations = ::testing::Types<
+
+  // 16 bits
+
+  ugregorian_t<std::uint16_t, std::uint32_t>,
+  gregorian_t <std:: int16_t, std:: int32_t>,
+
+  // 32 bits
+
+  ugregorian_t<std::uint32_t, std::uint32_t>,
+  gregorian_t <std:: int32_t, std:: int32_t>,
+  gregorian_t <std:: int32_t, std:: int32_t, date_t<std::int32_t>{- 1912, 6, 23}>,
+
+  // 64 bits
+
+  ugregorian_t<std::uint64_t, std::uint64_t>,
+  gregorian_t <std:: int64_t, std:: int64_t>
+>;
+
+TYPED_TEST_SUITE(month_arithmetic_tests, month_arithmetic_implementations);
+
+/**
+ * Tests add_months and add_years on dates where clamping matters.
+ */
+TYPED_TEST(month_arithmetic_tests, examples) {
+
+  using A      = TypeParam;
+  using date_t = typename A::date_t;
+
+  ASSERT_EQ((date_t{2000,  2, 29}), A::add_months(date_t{2000,  1, 31},   1));
+  ASSERT_EQ((date_t{2001,  2, 28}), A::add_months(date_t{2001,  1, 31},   1));
+  ASSERT_EQ((date_t{2100,  2, 28}), A::add_months(date_t{2100,  1, 31},   1));
+  ASSERT_EQ((date_t{2000,  4, 30}), A::add_months(date_t{2000,  3, 31},   1));
+  ASSERT_EQ((date_t{2001,  1, 15}), A::add_months(date_t{2000, 12, 15},   1));
+  ASSERT_EQ((date_t{2000,  2, 29}), A::add_months(date_t{2000,  3, 31},  -1));
+  ASSERT_EQ((date_t{1999, 12, 31}), A::add_months(date_t{2001,  1, 31}, -13));
+  ASSERT_EQ((date_t{2001,  2, 28}), A::add_years (date_t{2000,  2, 29},   1));
+  ASSERT_EQ((date_t{2004,  2, 29}), A::add_years (date_t{2000,  2, 29},   4));
+  ASSERT_EQ((date_t{1900,  2, 28}), A::add_years (date_t{2000,  2, 29}, -100));
+
+  auto const r = A::to_rata_die(date_t{2000, 1, 31});
+  ASSERT_EQ(A::to_rata_die(date_t{2000, 2, 29}), A::add_months(r,  1));
+  ASSERT_EQ(A::to_rata_die(date_t{2001, 1, 31}), A::add_years (r,  1));
+}
+
+/**
+ * Tests whether add_months and add_years, scalar and batch, match the floored division of months on
+ * windows of rata dies starting near round_rata_die_min, around 0 and ending near
+ * round_rata_die_max.
+ */
+TYPED_TEST(month_arithmetic_tests, add_months) {
+
+  using A          = TypeParam;
+  using date_t     = typename A::date_t;
+  using year_t     = typename A::year_t;
+  using rata_die_t = typename A::rata_die_t;
+  using months_t   = std::make_signed_t<rata_die_t>;
+
+  // Not a multiple of the number of lanes to exercise the scalar tail.
+  auto constexpr size = std::size_t(65537);
+
+  // Results must stay in range: 100 months span less than 9 years.
+  auto constexpr margin = rata_die_t(9 * 366);
+
+  std::vector<rata_die_t> rata_dies(size);
+  std::vector<rata_die_t> expected (size);
+  std::vector<rata_die_t> results  (size);
+
+  for (auto const first : { rata_die_t(A::round_rata_die_min + margin),
+    std::is_signed_v<rata_die_t> ? rata_die_t(-rata_die_t(size / 2)) : rata_die_t(1 << 20),
+    rata_die_t(A::round_rata_die_max - margin - size) }) {
+
+    std::iota(rata_dies.begin(), rata_dies.end(), first);
+
+    for (months_t const n : { -100, -25, -13, -12, -1, 0, 1, 11, 12, 13, 100 }) {
+
+      for (std::size_t i = 0; i < size; ++i) {
+
+        auto const u = A::to_date(rata_dies[i]);
+        auto const k = 12 * std::int64_t(u.year) + u.month - 1 + n;
+        auto const y = year_t(k / 12 - (k % 12 < 0));
+        auto const m = month_t(k - 12 * std::int64_t(y) + 1);
+        auto const v = date_t{y, m, std::min(u.day, last_day_of_month(y, m))};
+
+        ASSERT_EQ(v, A::add_months(u, n)) << "Failed for date = " << u << " and n = " << n;
+        expected[i] = A::to_rata_die(v);
+        ASSERT_EQ(expected[i], A::add_months(rata_dies[i], n)) << "Failed for date = " << u <<
+          " and n = " << n;
+
+        if (n % 12 == 0) {
+          ASSERT_EQ(v, A::add_years(u, n / 12)) << "Failed for date = " << u << " and n = " << n;
+          ASSERT_EQ(expected[i], A::add_years(rata_dies[i], n / 12)) << "Failed for date = " <<
+            u << " and n = " << n;
+        }
+      }
+
+      for (auto tier = simd::tier_t::scalar; tier <= simd::detected_tier();
+        tier = simd::tier_t(int(tier) + 1)) {
+
+        simd::set_tier(tier);
+        A::add_months(rata_dies, n, results);
+
+        for (std::size_t i = 0; i < size; ++i)
+          ASSERT_EQ(expected[i], results[i]) << "Failed for rata_die = " << rata_dies[i] <<
+            ", n = " << n << " and tier = " << int(tier);
+      }
+    }
+  }
+
+  simd::set_tier(simd::detected_tier());
+}
+
+/**
+ * Tests months_between and years_between on dates where the end of month semantics matters.
+ */
+TYPED_TEST(month_arithmetic_tests, between_examples) {
+
+  using A      = TypeParam;
+  using date_t = typename A::date_t;
+
+  ASSERT_EQ(  1, A::months_between(date_t{2001,  1, 31}, date_t{2001,  2, 28}));
+  ASSERT_EQ(  0, A::months_between(date_t{2000,  1, 31}, date_t{2000,  2, 28}));
+  ASSERT_EQ(  1, A::months_between(date_t{2000,  1, 31}, date_t{2000,  2, 29}));
+  ASSERT_EQ(  0, A::months_between(date_t{2001,  1, 30}, date_t{2001,  2, 27}));
+  ASSERT_EQ(  1, A::months_between(date_t{2000,  3, 31}, date_t{2000,  4, 30}));
+  ASSERT_EQ( 12, A::months_between(date_t{2000,  1, 15}, date_t{2001,  1, 15}));
+  ASSERT_EQ( 11, A::months_between(date_t{2000,  1, 15}, date_t{2001,  1, 14}));
+  ASSERT_EQ(  0, A::months_between(date_t{2000,  1, 15}, date_t{2000,  1, 15}));
+  ASSERT_EQ( -1, A::months_between(date_t{2001,  2, 28}, date_t{2001,  1, 31}));
+  ASSERT_EQ(  0, A::months_between(date_t{2001,  2, 27}, date_t{2001,  1, 30}));
+  ASSERT_EQ(-11, A::months_between(date_t{2001,  1, 14}, date_t{2000,  1, 15}));
+
+  ASSERT_EQ(  1, A::years_between (date_t{2000,  2, 29}, date_t{2001,  2, 28}));
+  ASSERT_EQ(  0, A::years_between (date_t{2000,  3,  1}, date_t{2001,  2, 28}));
+  ASSERT_EQ(  4, A::years_between (date_t{2000,  2, 29}, date_t{2004,  2, 29}));
+  ASSERT_EQ( -1, A::years_between (date_t{2001,  2, 28}, date_t{2000,  2, 29}));
+  ASSERT_EQ( 99, A::years_between (date_t{1900,  3,  1}, date_t{2000,  2, 29}));
+
+  auto const r0 = A::to_rata_die(date_t{2001, 1, 31});
+  auto const r1 = A::to_rata_die(date_t{2002, 2, 28});
+  ASSERT_EQ( 13, A::months_between(r0, r1));
+  ASSERT_EQ(-13, A::months_between(r1, r0));
+  ASSERT_EQ(  1, A::years_between (r0, r1));
+  ASSERT_EQ( -1, A::years_between (r1, r0));
+}
+
+/**
+ * Tests whether months_between and years_between, scalar and batch, match the largest k such that
+ * add_months(u, k) <= v (and antisymmetry) on windows of rata dies starting near
+ * round_rata_die_min, around 0 and ending near round_rata_die_max.
+ */
+TYPED_TEST(month_arithmetic_tests, months_between) {
+
+  using A          = TypeParam;
+  using rata_die_t = typename A::rata_die_t;
+  using months_t   = std::make_signed_t<rata_die_t>;
+
+  // Not a multiple of the number of lanes to exercise the scalar tail.
+  auto constexpr size = std::size_t(65537);
+
+  auto constexpr margin = rata_die_t(1461);
+
+  std::vector<rata_die_t> rata_dies0(size);
+  std::vector<rata_die_t> rata_dies1(size);
+  std::vector<months_t>   expected_months(size);
+  std::vector<months_t>   expected_years (size);
+  std::vector<months_t>   results        (size);
+
+  for (auto const first : { rata_die_t(A::round_rata_die_min + margin),
+    std::is_signed_v<rata_die_t> ? rata_die_t(-rata_die_t(size / 2)) : rata_die_t(1 << 20),
+    rata_die_t(A::round_rata_die_max - margin - size) }) {
+
+    std::iota(rata_dies0.begin(), rata_dies0.end(), first);
+
+    for (months_t const delta : { -1461, -366, -365, -31, -30, -29, -28, -1, 0, 1, 27, 28, 29, 30,
+      31, 59, 365, 366, 1461 }) {
+
+      for (std::size_t i = 0; i < size; ++i) {
+
+        rata_dies1[i] = rata_die_t(rata_dies0[i] + delta);
+
+        auto const s = delta < 0;
+        auto const u = A::to_date(s ? rata_dies1[i] : rata_dies0[i]);
+        auto const v = A::to_date(s ? rata_dies0[i] : rata_dies1[i]);
+        auto       k = 12 * (months_t(v.year) - months_t(u.year)) + v.month - u.month;
+        if (v < A::add_months(u, k))
+          --k;
+
+        expected_months[i] = s ? -k : k;
+        expected_years [i] = expected_months[i] / 12;
+
+        ASSERT_EQ(expected_months[i], A::months_between(s ? v : u, s ? u : v)) <<
+          "Failed for u = " << u << " and v = " << v;
+        ASSERT_EQ(expected_months[i], A::months_between(rata_dies0[i], rata_dies1[i])) <<
+          "Failed for u = " << u << " and v = " << v;
+        ASSERT_EQ(expected_years[i], A::years_between(s ? v : u, s ? u : v)) <<
+          "Failed for u = " << u << " and v = " << v;
+        ASSERT_EQ(expected_years[i], A::years_between(rata_dies0[i], rata_dies1[i])) <<
+          "Failed for u = " << u << " and v = " << v;
+      }
+
+      for (auto tier = simd::tier_t::scalar; tier <= simd::detected_tier();
+        tier = simd::tier_t(int(tier) + 1)) {
+
+        simd::set_tier(tier);
+
+        A::months_between(rata_dies0, rata_dies1, results);
+        for (std::size_t i = 0; i < size; ++i)
+          ASSERT_EQ(expected_months[i], results[i]) << "Failed for rata_die = " <<
+            rata_dies0[i] << ", delta = " << delta << " and tier = " << int(tier);
+
+        A::years_between(rata_dies0, rata_dies1, results);
+        for (std::size_t i = 0; i < size; ++i)
+          ASSERT_EQ(expected_years[i], results[i]) << "Failed for rata_die = " <<
+            rata_dies0[i] << ", delta = " << delta << " and tier = " << int(tier);
+      }
+    }
+  }
+
+  simd::set_tier(simd::detected_tier());
+}
+
+//--------------------------------------------------------------------------------------------------
+// ISO 8601 formatting
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+struct iso_8601_tests : public ::testing::Test {
+}; // struct iso_8601_tests
+
+using iso_8601_year_types = ::testing::Types<std::int16_t, std::uint16_t, std::int32_t,
+  std::uint32_t, std::int64_t, std::uint64_t>;
+
+TYPED_TEST_SUITE(iso_8601_tests, iso_8601_year_types);
+
+/**
+ * Returns a given date in ISO 8601 extended format using std::ostream.
+ *
+ * @tparam Y          Year storage type.
+ * @param  u          The given date.
+ */
+template <typename Y>
+std::string
+iso_8601(date_t<Y> const& u) {
+
+  auto const s = std::is_signed_v<Y> && u.year < 0;
+  auto const n = s ? std::uint64_t(0 - std::uint64_t(u.year)) : std::uint64_t(u.year);
+
+  std::ostringstream os;
+  os << (s ? "-" : n > 9999 ? "+" : "") << std::setfill('0') << std::setw(4) << n << '-' <<
+    std::setw(2) << std::uint32_t(u.month) << '-' << std::setw(2) << std::uint32_t(u.day);
+  return os.str();
+}
+
+/**
+ * Tests whether to_chars, scalar and batch, matches std::ostream on windows of years starting at
+ * min<T>, around 0, around 10000 and ending at max<T> and whether it reports buffers that are too
+ * small.
+ */
+TYPED_TEST(iso_8601_tests, to_chars) {
+
+  using T = TypeParam;
+
+  auto constexpr window = T(400);
+
+  std::vector<date_t<T>> dates;
+
+  for (auto const first : { min<T>, T(std::is_signed_v<T> ? -window / 2 : 0),
+    T(10000 - window / 2), T(max<T> - window + 1) })
+    for (T y = first; y != T(first + window); ++y)
+      for (month_t m = 1; m <= 12; ++m)
+        for (day_t d = 1; d <= last_day_of_month(T(y % 400), m); ++d)
+          dates.push_back({y, m, d});
+
+  ASSERT_EQ("2024-02-29", iso_8601(date_t<T>{2024, 2, 29}));
+
+  std::string expected;
+  char        buffer[iso_8601_date_size<T>];
+
+  for (auto const& u : dates) {
+
+    auto const s = iso_8601(u);
+    expected += s;
+    expected += ',';
+
+    ASSERT_LE(s.size(), iso_8601_date_size<T>) << "Failed for u = " << u;
+
+    auto const r = to_chars(buffer, std::end(buffer), u);
+    ASSERT_EQ(std::errc(), r.ec) << "Failed for u = " << u;
+    ASSERT_EQ(s, std::string(buffer, r.ptr)) << "Failed for u = " << u;
+
+    auto const e = to_chars(buffer, buffer + s.size() - 1, u);
+    ASSERT_EQ(std::errc::value_too_large, e.ec) << "Failed for u = " << u;
+    ASSERT_EQ(buffer + s.size() - 1, e.ptr) << "Failed for u = " << u;
+  }
+
+  std::string result(expected.size(), ' ');
+  auto const  first = result.data();
+  auto const  last  = first + result.size();
+
+  auto const r = to_chars(first, last, std::span<date_t<T> const>(dates), ',');
+  ASSERT_EQ(std::errc(), r.ec);
+  ASSERT_EQ(last, r.ptr);
+  ASSERT_EQ(expected, result);
+
+  date_columns_t<T> columns;
+  for (auto const& u : dates)
+    columns.push_back(u);
+
+  std::fill(first, last, ' ');
+  auto const c = to_chars(first, last, columns, ',');
+  ASSERT_EQ(std::errc(), c.ec);
+  ASSERT_EQ(last, c.ptr);
+  ASSERT_EQ(expected, result);
+
+  auto const e = to_chars(first, last - 1, std::span<date_t<T> const>(dates), ',');
+  ASSERT_EQ(std::errc::value_too_large, e.ec);
+  ASSERT_EQ(last - 1, e.ptr);
+}
+
+/**
+ * Tests whether from_chars round trips to_chars on windows of years starting at min<T>, around 0,
+ * around 10000 and ending at max<T>.
+ */
+TYPED_TEST(iso_8601_tests, from_chars) {
+
+  using T = TypeParam;
+
+  auto constexpr window = T(400);
+
+  char buffer[iso_8601_date_size<T> + 1];
+
+  for (auto const first : { min<T>, T(std::is_signed_v<T> ? -window / 2 : 0),
+    T(10000 - window / 2), T(max<T> - window + 1) }) {
+    for (T y = first; y != T(first + window); ++y) {
+      for (month_t m = 1; m <= 12; ++m) {
+        // Leapness depends on y % 400 only (and y might be out of is_leap_year's domain).
+        for (day_t d = 1; d <= last_day_of_month(T(y % 400), m); ++d) {
+
+          auto const u   = date_t<T>{y, m, d};
+          auto const end = to_chars(buffer, u);
+          *end = 'x';
+
+          date_t<T> v{};
+          auto const r = from_chars(buffer, end + 1, v);
+
+          ASSERT_EQ(std::errc(), r.ec) << "Failed for u = " << u;
+          ASSERT_EQ(end, r.ptr) << "Failed for u = " << u;
+          ASSERT_EQ(u, v) << "Failed for u = " << u;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Tests from_chars on invalid inputs and on years which are not representable.
+ */
+TYPED_TEST(iso_8601_tests, from_chars_errors) {
+
+  using T = TypeParam;
+
+  for (std::string const s : { "", "2024-02-2", "2024-02-30", "2023-02-29", "2100-02-29",
+    "2024-00-10", "2024-13-10", "2024-01-00", "2024-01-32", "2024/01/10", "2024-1-10 ",
+    "202a-01-10", "2024-0:-10", "10000-01-01", "+999-01-01", "+2024-02-30", "-2024-02-",
+    "+-2024-01-01", " 2024-01-01", "2024-01-1a" }) {
+
+    auto const u = date_t<T>{1, 2, 3};
+    auto       v = u;
+    auto const r = from_chars(s.data(), s.data() + s.size(), v);
+
+    ASSERT_EQ(std::errc::invalid_argument, r.ec) << "Failed for s = " << s;
+    ASSERT_EQ(s.data(), r.ptr) << "Failed for s = " << s;
+    ASSERT_EQ(u, v) << "Failed for s = " << s;
+  }
+
+  // Appending a digit to the year multiplies its magnitude by 10.
+  auto const too_large = std::string("+") + std::to_string(max<T>) + "0-01-01";
+  auto const too_small = std::is_signed_v<T> ? std::to_string(min<T>) + "0-01-01" :
+    std::string("-0001-01-01");
+
+  for (auto const& s : { too_large, too_small, std::string("+99999999999999999999999-01-01") }) {
+    date_t<T> v;
+    auto const r = from_chars(s.data(), s.data() + s.size(), v);
+    ASSERT_EQ(std::errc::result_out_of_range, r.ec) << "Failed for s = " << s;
+    ASSERT_EQ(s.data(), r.ptr) << "Failed for s = " << s;
+  }
+
+  std::string const leap = "+2000-02-29";
+  date_t<T> v;
+  auto const r = from_chars(leap.data(), leap.data() + leap.size(), v);
+  ASSERT_EQ(std::errc(), r.ec);
+  ASSERT_EQ((date_t<T>{2000, 2, 29}), v);
+}
+
+template <typename A>
+struct iso_8601_calendar_tests : public ::testing::Test {
+}; // struct iso_8601_calendar_tests
+
+using iso_8601_implementations = ::testing::Types<
+
+  // 16 bits
+
+  ugregorian_t<std::uint16_t, std::uint32_t>,
+  gregorian_t <std:: int16_t, std:: int32_t>,
+
+  // 32 bits
+
+  ugregorian_t<std::uint32_t, std::uint32_t>,
+  gregorian_t <std:: int32_t, std:: int32_t>,
+  gregorian_t <std:: int32_t, std:: int32_t, date_t<std::int32_t>{- 1912, 6, 23}>,
+
+  // 64 bits
+
+  ugregorian_t<std::uint64_t, std::uint64_t>,
+  gregorian_t <std:: int64_t, std:: int64_t>
+>;
+
+TYPED_TEST_SUITE(iso_8601_calendar_tests, iso_8601_implementations);
+
+/**
+ * Tests whether scalar and batch from_chars on rata dies match to_rata_die on windows of years
+ * starting at 0, around 2000 and ending at 9999, including invalid days, months and characters.
+ */
+TYPED_TEST(iso_8601_calendar_tests, from_chars) {
+
+  using A          = TypeParam;
+  using date_t     = typename A::date_t;
+  using year_t     = typename A::year_t;
+  using rata_die_t = typename A::rata_die_t;
+
+  auto constexpr width = std::size_t(11);
+
+  std::string chars;
+  std::vector<date_t> dates;
+
+  for (auto const first : { 0, 1900, 9800 }) {
+    for (auto y = first; y < first + 200; ++y) {
+      for (month_t m = 0; m <= 13; ++m) {
+        for (day_t d = 0; d <= 32; ++d) {
+
+          char buffer[width];
+          auto const u = date_t{year_t(y), m, d};
+          to_chars(buffer, u);
+          buffer[width - 1] = '\n';
+
+          // Corrupts some characters.
+          if (d == 15 && m % 4 == 1)
+            buffer[(y + m) % 10] = "x:/ -+"[y % 6];
+
+          chars.append(buffer, width);
+          dates.push_back(u);
+        }
+      }
+    }
+  }
+
+  // The last record has no delimiter.
+  chars.pop_back();
+
+  auto const size = dates.size();
+
+  std::vector<rata_die_t>    rata_dies(size);
+  std::vector<std::uint64_t> valid((size + 63) / 64);
+
+  A::from_chars(chars, width, rata_dies, valid);
+
+  for (std::size_t i = 0; i < size; ++i) {
+
+    auto const first = chars.data() + width * i;
+    auto const s     = std::string(first, 10);
+
+    rata_die_t n = 0;
+    auto const r = A::from_chars(first, first + 10, n);
+
+    auto const& u  = dates[i];
+    auto const  ok = s == iso_8601(u) && 1 <= u.month && u.month <= 12 && 1 <= u.day &&
+      u.day <= last_day_of_month(u.year, u.month) && A::date_min <= u && u <= A::date_max;
+
+    ASSERT_EQ(ok, r.ec == std::errc()) << "Failed for s = " << s;
+    ASSERT_EQ(ok, (valid[i / 64] >> i % 64) & 1) << "Failed for s = " << s;
+
+    if (ok) {
+      ASSERT_EQ(A::to_rata_die(u), n) << "Failed for s = " << s;
+      ASSERT_EQ(A::to_rata_die(u), rata_dies[i]) << "Failed for s = " << s;
+    }
+  }
+
+  ASSERT_EQ(0u, valid.back() >> size % 64) << "Unused bits are not cleared.";
+}